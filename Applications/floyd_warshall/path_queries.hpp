@@ -0,0 +1,313 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef APPLICATIONS_FLOYD_WARSHALL_PATH_QUERIES_HPP
+#define APPLICATIONS_FLOYD_WARSHALL_PATH_QUERIES_HPP
+
+#include "example_utils.hpp"
+#include "sparse_shortest_paths.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <vector>
+
+/// \brief A request for the shortest path from \p source to \p destination.
+struct path_query
+{
+    unsigned int source;
+    unsigned int destination;
+};
+
+/// \brief Returns the node that precedes \p y in the shortest path from \p x to \p y. If
+/// <tt>next_matrix[a][y] = k</tt> with <tt>k != a</tt>, the path from a to y goes through k, so the
+/// predecessor of y is found by following the second half of the path until it is a single edge.
+__host__ __device__ inline unsigned int path_predecessor(const unsigned int* next_matrix,
+                                                         const unsigned int  nodes,
+                                                         const unsigned int  x,
+                                                         const unsigned int  y)
+{
+    unsigned int a = x;
+    unsigned int k = next_matrix[static_cast<size_t>(a) * nodes + y];
+    while(k != a)
+    {
+        a = k;
+        k = next_matrix[static_cast<size_t>(a) * nodes + y];
+    }
+    return a;
+}
+
+/// \brief Returns the number of nodes in the shortest path of \p query, or 0 if there is none.
+__host__ __device__ inline unsigned int path_length(const unsigned int* next_matrix,
+                                                    const unsigned int* distance_matrix,
+                                                    const unsigned int  nodes,
+                                                    const path_query    query)
+{
+    const unsigned int x = query.source;
+    const unsigned int y = query.destination;
+    if(distance_matrix[static_cast<size_t>(x) * nodes + y] >= infinite_distance)
+    {
+        return 0;
+    }
+
+    unsigned int length = 1;
+    for(unsigned int z = y; z != x; z = path_predecessor(next_matrix, nodes, x, z))
+    {
+        ++length;
+    }
+    return length;
+}
+
+/// \brief Writes the \p length nodes of the shortest path of \p query to \p path, backwards from
+/// the destination.
+__host__ __device__ inline void write_path(const unsigned int* next_matrix,
+                                           const unsigned int  nodes,
+                                           const path_query    query,
+                                           const unsigned int  length,
+                                           unsigned int*       path)
+{
+    unsigned int z = query.destination;
+    for(unsigned int i = length; i > 0; --i)
+    {
+        path[i - 1] = z;
+        z           = path_predecessor(next_matrix, nodes, query.source, z);
+    }
+}
+
+/// \brief Computes the number of nodes in the shortest path of each query.
+__global__ void path_length_kernel(const unsigned int* next_matrix,
+                                   const unsigned int* distance_matrix,
+                                   const unsigned int  nodes,
+                                   const path_query*   queries,
+                                   const unsigned int  query_count,
+                                   unsigned int*       lengths)
+{
+    const unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if(i < query_count)
+    {
+        lengths[i] = path_length(next_matrix, distance_matrix, nodes, queries[i]);
+    }
+}
+
+/// \brief Writes the shortest path of each query at its offset of the compacted \p paths buffer.
+__global__ void path_write_kernel(const unsigned int*       next_matrix,
+                                  const unsigned int        nodes,
+                                  const path_query*         queries,
+                                  const unsigned int        query_count,
+                                  const unsigned long long* path_offsets,
+                                  unsigned int*             paths)
+{
+    const unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if(i < query_count)
+    {
+        const unsigned long long offset = path_offsets[i];
+        const unsigned int length = static_cast<unsigned int>(path_offsets[i + 1] - offset);
+        write_path(next_matrix, nodes, queries[i], length, paths + offset);
+    }
+}
+
+/// \brief Computes the exclusive prefix sum of the \p BlockSize values of each block and stores
+/// the sum of all of them in \p block_sums.
+template<unsigned int BlockSize, typename T, typename U>
+__global__ void block_exclusive_scan_kernel(const T*           input,
+                                            U*                 output,
+                                            U*                 block_sums,
+                                            const unsigned int size)
+{
+    __shared__ U block[BlockSize];
+
+    const unsigned int i = blockIdx.x * BlockSize + threadIdx.x;
+    block[threadIdx.x]   = (i < size) ? static_cast<U>(input[i]) : U{};
+    __syncthreads();
+
+    // Hillis-Steele inclusive scan in shared memory.
+    for(unsigned int offset = 1; offset < BlockSize; offset <<= 1)
+    {
+        const U value = (threadIdx.x >= offset) ? block[threadIdx.x - offset] : U{};
+        __syncthreads();
+        block[threadIdx.x] += value;
+        __syncthreads();
+    }
+
+    if(i < size)
+    {
+        output[i] = (threadIdx.x == 0) ? U{} : block[threadIdx.x - 1];
+    }
+    if(threadIdx.x == BlockSize - 1)
+    {
+        block_sums[blockIdx.x] = block[threadIdx.x];
+    }
+}
+
+/// \brief Adds to every value of each block the (scanned) sum of the previous blocks.
+template<unsigned int BlockSize, typename U>
+__global__ void add_block_offsets_kernel(U* output, const U* block_offsets, const unsigned int size)
+{
+    const unsigned int i = blockIdx.x * BlockSize + threadIdx.x;
+    if(i < size)
+    {
+        output[i] += block_offsets[blockIdx.x];
+    }
+}
+
+/// \brief Returns the number of values of the temporary storage needed by \p exclusive_scan.
+template<unsigned int BlockSize>
+unsigned int exclusive_scan_storage_size(const unsigned int size)
+{
+    const unsigned int blocks = ceiling_div(size, BlockSize);
+    return blocks + 1 + (blocks > 1 ? exclusive_scan_storage_size<BlockSize>(blocks) : 0);
+}
+
+/// \brief Computes on the device the exclusive prefix sum of the \p size values of \p d_input
+/// into \p d_output, and writes the total sum to <tt>d_output[size]</tt>. The sums of the blocks
+/// are scanned recursively, using \p d_storage (of \p exclusive_scan_storage_size values) as
+/// temporary storage.
+template<unsigned int BlockSize, typename T, typename U>
+void exclusive_scan(const T*           d_input,
+                    U*                 d_output,
+                    U*                 d_storage,
+                    const unsigned int size,
+                    hipStream_t        stream)
+{
+    const unsigned int blocks = ceiling_div(size, BlockSize);
+
+    // The last entry of the scanned block sums is the total sum.
+    U* d_block_offsets = d_storage;
+
+    block_exclusive_scan_kernel<BlockSize>
+        <<<blocks, BlockSize, 0, stream>>>(d_input, d_output, d_block_offsets, size);
+    HIP_CHECK(hipGetLastError());
+
+    if(blocks > 1)
+    {
+        exclusive_scan<BlockSize>(d_block_offsets,
+                                  d_block_offsets,
+                                  d_storage + blocks + 1,
+                                  blocks,
+                                  stream);
+        add_block_offsets_kernel<BlockSize>
+            <<<blocks, BlockSize, 0, stream>>>(d_output, d_block_offsets, size);
+        HIP_CHECK(hipGetLastError());
+    }
+
+    HIP_CHECK(hipMemcpyAsync(d_output + size,
+                             d_block_offsets + (blocks > 1 ? blocks : 0),
+                             sizeof(U),
+                             hipMemcpyDeviceToDevice,
+                             stream));
+}
+
+/// \brief Returns the number of values of the temporary storage needed by
+/// \p compute_path_offsets for a batch of \p query_count queries.
+inline unsigned int path_offsets_storage_size(const unsigned int query_count)
+{
+    return exclusive_scan_storage_size<256>(query_count);
+}
+
+/// \brief Computes the path offsets of a batch of \p query_count queries from the next and
+/// distance matrices (in device memory) of a graph with \p nodes nodes: the path of query i is
+/// stored in <tt>[d_path_offsets[i], d_path_offsets[i + 1])</tt> of the compacted paths buffer.
+/// \p d_path_offsets must hold <tt>query_count + 1</tt> values, \p d_lengths \p query_count
+/// values and \p d_storage <tt>path_offsets_storage_size(query_count)</tt> values. Returns the
+/// total number of nodes of all paths, which is the required size of the paths buffer.
+inline unsigned long long compute_path_offsets(const unsigned int* d_next_matrix,
+                                               const unsigned int* d_distance_matrix,
+                                               const unsigned int  nodes,
+                                               const path_query*   d_queries,
+                                               const unsigned int  query_count,
+                                               unsigned int*       d_lengths,
+                                               unsigned long long* d_path_offsets,
+                                               unsigned long long* d_storage,
+                                               hipStream_t         stream)
+{
+    constexpr unsigned int block_size = 256;
+
+    path_length_kernel<<<ceiling_div(query_count, block_size), block_size, 0, stream>>>(
+        d_next_matrix,
+        d_distance_matrix,
+        nodes,
+        d_queries,
+        query_count,
+        d_lengths);
+    HIP_CHECK(hipGetLastError());
+
+    exclusive_scan<block_size>(d_lengths, d_path_offsets, d_storage, query_count, stream);
+
+    unsigned long long total_length;
+    HIP_CHECK(hipMemcpyAsync(&total_length,
+                             d_path_offsets + query_count,
+                             sizeof(unsigned long long),
+                             hipMemcpyDeviceToHost,
+                             stream));
+    HIP_CHECK(hipStreamSynchronize(stream));
+    return total_length;
+}
+
+/// \brief Writes the paths of a batch of queries to \p d_paths, at the offsets computed by
+/// \p compute_path_offsets.
+inline void write_paths(const unsigned int*       d_next_matrix,
+                        const unsigned int        nodes,
+                        const path_query*         d_queries,
+                        const unsigned int        query_count,
+                        const unsigned long long* d_path_offsets,
+                        unsigned int*             d_paths,
+                        hipStream_t               stream)
+{
+    constexpr unsigned int block_size = 256;
+
+    path_write_kernel<<<ceiling_div(query_count, block_size), block_size, 0, stream>>>(
+        d_next_matrix,
+        nodes,
+        d_queries,
+        query_count,
+        d_path_offsets,
+        d_paths);
+    HIP_CHECK(hipGetLastError());
+}
+
+/// \brief Reference CPU implementation of the path reconstruction, for results verification and
+/// performance comparison. \p path_offsets must hold <tt>queries.size() + 1</tt> values.
+inline void reconstruct_paths_reference(const unsigned int*              next_matrix,
+                                        const unsigned int*              distance_matrix,
+                                        const unsigned int               nodes,
+                                        const std::vector<path_query>&   queries,
+                                        std::vector<unsigned long long>& path_offsets,
+                                        std::vector<unsigned int>&       paths)
+{
+    path_offsets[0] = 0;
+    for(size_t i = 0; i < queries.size(); ++i)
+    {
+        path_offsets[i + 1]
+            = path_offsets[i] + path_length(next_matrix, distance_matrix, nodes, queries[i]);
+    }
+
+    paths.resize(path_offsets[queries.size()]);
+    for(size_t i = 0; i < queries.size(); ++i)
+    {
+        write_path(next_matrix,
+                   nodes,
+                   queries[i],
+                   static_cast<unsigned int>(path_offsets[i + 1] - path_offsets[i]),
+                   paths.data() + path_offsets[i]);
+    }
+}
+
+#endif // APPLICATIONS_FLOYD_WARSHALL_PATH_QUERIES_HPP
@@ -0,0 +1,591 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef APPLICATIONS_FLOYD_WARSHALL_SPARSE_SHORTEST_PATHS_HPP
+#define APPLICATIONS_FLOYD_WARSHALL_SPARSE_SHORTEST_PATHS_HPP
+
+#include "example_utils.hpp"
+#include "sparse_io_utils.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+/// \brief Distance assigned to pairs of nodes that are not connected. It is half of the maximum
+/// \p int so that the sum of two distances, as computed by the Floyd-Warshall kernel, cannot
+/// overflow.
+constexpr unsigned int infinite_distance = std::numeric_limits<int>::max() / 2;
+
+/// \brief Value of a tentative (packed) distance of a node that has not been reached yet.
+constexpr unsigned long long unreached_node = std::numeric_limits<unsigned long long>::max();
+
+/// \brief Value of the distance to the next bucket of a source without pending nodes.
+constexpr unsigned int no_pending_nodes = std::numeric_limits<unsigned int>::max();
+
+/// \brief Directed and weighted graph stored as a (square) CSR adjacency matrix, with the same
+/// layout used by the rocSPARSE examples: the out-edges of node \p i are the entries
+/// <tt>[csr_row_ptr[i], csr_row_ptr[i + 1])</tt> of \p csr_col_ind (target node) and \p csr_val
+/// (weight of the edge).
+struct csr_graph
+{
+    unsigned int              nodes{};
+    std::vector<unsigned int> csr_row_ptr;
+    std::vector<unsigned int> csr_col_ind;
+    std::vector<unsigned int> csr_val;
+
+    unsigned int edges() const
+    {
+        return static_cast<unsigned int>(csr_col_ind.size());
+    }
+};
+
+/// \brief Generates a strongly connected sparse graph, in which each node has \p degree out-edges
+/// with weights in <tt>[1, max_weight]</tt>. Every node is linked to the next one, so that the
+/// graph resembles a (long) road with \p degree - 1 random shortcuts per node.
+inline csr_graph generate_sparse_graph(const unsigned int nodes,
+                                       const unsigned int degree,
+                                       const unsigned int max_weight = 100)
+{
+    std::default_random_engine                  generator;
+    std::uniform_int_distribution<unsigned int> node_distribution(0, nodes - 1);
+    std::uniform_int_distribution<unsigned int> weight_distribution(1, max_weight);
+
+    csr_graph graph;
+    graph.nodes = nodes;
+    graph.csr_row_ptr.resize(nodes + 1);
+    graph.csr_col_ind.reserve(static_cast<size_t>(nodes) * degree);
+    graph.csr_val.reserve(static_cast<size_t>(nodes) * degree);
+
+    std::vector<std::pair<unsigned int, unsigned int>> row;
+    for(unsigned int x = 0; x < nodes; ++x)
+    {
+        graph.csr_row_ptr[x] = graph.edges();
+
+        row.clear();
+        row.emplace_back((x + 1) % nodes, weight_distribution(generator));
+        for(unsigned int e = 1; e < degree; ++e)
+        {
+            row.emplace_back(node_distribution(generator), weight_distribution(generator));
+        }
+
+        // Keep the column indices of each row sorted, as rocSPARSE expects.
+        std::sort(row.begin(), row.end());
+        for(const auto& [y, weight] : row)
+        {
+            graph.csr_col_ind.push_back(y);
+            graph.csr_val.push_back(weight);
+        }
+    }
+    graph.csr_row_ptr[nodes] = graph.edges();
+
+    return graph;
+}
+
+/// \brief Loads a graph from the file \p path, in any of the formats supported by
+/// \p load_csr_matrix. Edge weights are rounded to the nearest positive integer, and edges without
+/// weight get weight 1. If the adjacency matrix is not square, the graph has as many nodes as the
+/// largest of its dimensions.
+inline csr_graph load_sparse_graph(const std::string& path, bool* loaded_from_cache = nullptr)
+{
+    csr_matrix<unsigned int, double> matrix
+        = load_csr_matrix<unsigned int, double>(path,
+                                                true,
+                                                default_loader_threads(),
+                                                loaded_from_cache);
+
+    csr_graph graph;
+    graph.nodes       = std::max(matrix.rows, matrix.cols);
+    graph.csr_row_ptr = std::move(matrix.row_ptr);
+    graph.csr_col_ind = std::move(matrix.col_ind);
+    graph.csr_row_ptr.resize(graph.nodes + 1, graph.edges());
+    graph.csr_val.resize(matrix.val.size());
+    for(size_t e = 0; e < matrix.val.size(); ++e)
+    {
+        if(!(matrix.val[e] >= 0.0) || matrix.val[e] >= infinite_distance)
+        {
+            throw std::runtime_error("Edge weights must be non-negative and less than "
+                                     + std::to_string(infinite_distance));
+        }
+        graph.csr_val[e] = std::max(1u, static_cast<unsigned int>(std::lround(matrix.val[e])));
+    }
+    return graph;
+}
+
+/// \brief Returns the dense adjacency matrix of \p graph, in the format expected by the
+/// Floyd-Warshall kernel. Missing edges get weight \p infinite_distance and, in the case of
+/// repeated edges, the lightest one is kept.
+inline std::vector<unsigned int> csr_graph_to_adjacency_matrix(const csr_graph& graph)
+{
+    const unsigned int        nodes = graph.nodes;
+    std::vector<unsigned int> adjacency_matrix(static_cast<size_t>(nodes) * nodes,
+                                               infinite_distance);
+    for(unsigned int x = 0; x < nodes; ++x)
+    {
+        adjacency_matrix[static_cast<size_t>(x) * nodes + x] = 0;
+        for(unsigned int e = graph.csr_row_ptr[x]; e < graph.csr_row_ptr[x + 1]; ++e)
+        {
+            unsigned int& d_x_y = adjacency_matrix[static_cast<size_t>(x) * nodes
+                                                   + graph.csr_col_ind[e]];
+            d_x_y               = std::min(d_x_y, graph.csr_val[e]);
+        }
+    }
+    return adjacency_matrix;
+}
+
+/// \brief Initializes the state of the delta-stepping algorithm for a batch of sources. The grid is
+/// two-dimensional: \p blockIdx.y selects the source and the x dimension covers the nodes.
+__global__ void delta_stepping_init_kernel(const unsigned int* sources,
+                                           unsigned long long* tentative,
+                                           unsigned int*       pending,
+                                           unsigned int*       bucket_end,
+                                           unsigned int*       next_distance,
+                                           unsigned int*       frontier_size,
+                                           const unsigned int  nodes,
+                                           const unsigned int  delta)
+{
+    const unsigned int batch  = blockIdx.y;
+    const unsigned int x      = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int source = sources[batch];
+
+    if(x < nodes)
+    {
+        // The distance (upper 32 bits) and the predecessor (lower 32 bits) of a node are packed in
+        // a single 64-bit word, so that both can be updated with a single atomic operation.
+        const size_t index = static_cast<size_t>(batch) * nodes + x;
+        tentative[index]   = (x == source) ? source : unreached_node;
+        pending[index]     = (x == source);
+    }
+    if(x == 0)
+    {
+        bucket_end[batch]    = delta;
+        next_distance[batch] = no_pending_nodes;
+        frontier_size[batch] = 0;
+    }
+}
+
+/// \brief Frontier compaction. Collects the pending nodes of the current bucket of each source,
+/// that is, the ones whose distance improved and is less than \p bucket_end, in a compact list.
+/// The smallest distance of the pending nodes outside of the bucket is also computed, which is
+/// where the next bucket starts once the current one is settled.
+template<unsigned int BlockSize>
+__global__ void delta_stepping_compact_kernel(const unsigned long long* tentative,
+                                              unsigned int*             pending,
+                                              const unsigned int*       bucket_end,
+                                              unsigned int*             next_distance,
+                                              unsigned int*             frontier,
+                                              unsigned int*             frontier_size,
+                                              const unsigned int        nodes)
+{
+    const unsigned int batch = blockIdx.y;
+    const unsigned int x     = blockIdx.x * BlockSize + threadIdx.x;
+    const size_t       index = static_cast<size_t>(batch) * nodes + x;
+
+    __shared__ unsigned int block_frontier[BlockSize];
+    __shared__ unsigned int block_frontier_size;
+    __shared__ unsigned int block_frontier_offset;
+
+    if(threadIdx.x == 0)
+    {
+        block_frontier_size = 0;
+    }
+    __syncthreads();
+
+    // Nodes are first gathered in shared memory, so that only a single global atomic is needed
+    // per block to reserve space in the frontier of the source.
+    if(x < nodes && pending[index])
+    {
+        const unsigned int distance = static_cast<unsigned int>(tentative[index] >> 32);
+        if(distance < bucket_end[batch])
+        {
+            pending[index] = 0;
+            block_frontier[atomicAdd(&block_frontier_size, 1u)] = x;
+        }
+        else
+        {
+            atomicMin(&next_distance[batch], distance);
+        }
+    }
+    __syncthreads();
+
+    if(threadIdx.x == 0 && block_frontier_size > 0)
+    {
+        block_frontier_offset = atomicAdd(&frontier_size[batch], block_frontier_size);
+    }
+    __syncthreads();
+
+    if(threadIdx.x < block_frontier_size)
+    {
+        frontier[static_cast<size_t>(batch) * nodes + block_frontier_offset + threadIdx.x]
+            = block_frontier[threadIdx.x];
+    }
+}
+
+/// \brief Relaxes the out-edges of every node in the frontier of each source. The tentative
+/// distance and predecessor of the target nodes are updated with a 64-bit \p atomicMin, so that
+/// ties between paths of the same length are broken towards the predecessor with the lowest index.
+__global__ void delta_stepping_relax_kernel(const unsigned int* csr_row_ptr,
+                                            const unsigned int* csr_col_ind,
+                                            const unsigned int* csr_val,
+                                            unsigned long long* tentative,
+                                            unsigned int*       pending,
+                                            const unsigned int* frontier,
+                                            const unsigned int* frontier_size,
+                                            const unsigned int  nodes)
+{
+    const unsigned int batch  = blockIdx.y;
+    const size_t       offset = static_cast<size_t>(batch) * nodes;
+    const unsigned int size   = frontier_size[batch];
+
+    for(unsigned int i = blockIdx.x * blockDim.x + threadIdx.x; i < size;
+        i += gridDim.x * blockDim.x)
+    {
+        const unsigned int       x        = frontier[offset + i];
+        const unsigned long long distance = tentative[offset + x] >> 32;
+
+        for(unsigned int e = csr_row_ptr[x]; e < csr_row_ptr[x + 1]; ++e)
+        {
+            const unsigned int y = csr_col_ind[e];
+
+            // Clamp the distance so that it always fits in the upper 32 bits.
+            unsigned long long d_x_y = distance + csr_val[e];
+            if(d_x_y > infinite_distance)
+            {
+                d_x_y = infinite_distance;
+            }
+            const unsigned long long candidate = d_x_y << 32 | x;
+
+            const unsigned long long previous = atomicMin(&tentative[offset + y], candidate);
+            if(d_x_y < previous >> 32)
+            {
+                pending[offset + y] = 1;
+            }
+        }
+    }
+}
+
+/// \brief Advances the bucket of every source whose current bucket has been settled, and counts
+/// the sources that still have pending nodes in \p active_sources. The per-iteration counters are
+/// reset for the next iteration.
+__global__ void delta_stepping_advance_kernel(unsigned int*      bucket_end,
+                                              unsigned int*      next_distance,
+                                              unsigned int*      frontier_size,
+                                              unsigned int*      active_sources,
+                                              const unsigned int batch_size,
+                                              const unsigned int delta)
+{
+    const unsigned int batch = blockIdx.x * blockDim.x + threadIdx.x;
+    if(batch >= batch_size)
+    {
+        return;
+    }
+
+    // If the frontier is not empty, the current bucket may still receive updates from the nodes that
+    // were just relaxed, so it needs to be processed again.
+    if(frontier_size[batch] > 0)
+    {
+        atomicAdd(active_sources, 1u);
+    }
+    // Otherwise, continue with the bucket of the closest pending node, if any.
+    else if(next_distance[batch] != no_pending_nodes)
+    {
+        // Distances never exceed infinite_distance, so the end of the bucket fits in 32 bits.
+        bucket_end[batch] = (next_distance[batch] / delta + 1) * delta;
+        atomicAdd(active_sources, 1u);
+    }
+
+    frontier_size[batch] = 0;
+    next_distance[batch] = no_pending_nodes;
+}
+
+/// \brief Unpacks the tentative distances of a batch of sources into rows of the distance and next
+/// matrices. As in the Floyd-Warshall example, <tt>next_matrix[x][y] = x</tt> means that the
+/// shortest path from node x to node y is the edge (x,y). Otherwise, the path is the one from x to
+/// <tt>next_matrix[x][y]</tt> followed by the one from there to y, which here is the single edge
+/// from the predecessor of y.
+__global__ void delta_stepping_output_kernel(const unsigned int*       sources,
+                                             const unsigned long long* tentative,
+                                             unsigned int*             distance_matrix,
+                                             unsigned int*             next_matrix,
+                                             const unsigned int        nodes)
+{
+    const unsigned int batch = blockIdx.y;
+    const unsigned int y     = blockIdx.x * blockDim.x + threadIdx.x;
+    if(y >= nodes)
+    {
+        return;
+    }
+
+    const size_t             index  = static_cast<size_t>(batch) * nodes + y;
+    const unsigned int       source = sources[batch];
+    const unsigned long long packed = tentative[index];
+
+    if(packed == unreached_node)
+    {
+        distance_matrix[index] = infinite_distance;
+        next_matrix[index]     = source;
+    }
+    else
+    {
+        distance_matrix[index] = static_cast<unsigned int>(packed >> 32);
+        next_matrix[index]     = static_cast<unsigned int>(packed);
+    }
+}
+
+/// \brief Computes the shortest paths from each node in \p sources to every node of \p graph with
+/// the delta-stepping algorithm. Up to \p batch_size sources are processed by each kernel launch.
+/// Row \p i of the (<tt>sources.size() x graph.nodes</tt>) \p distance_matrix and \p next_matrix
+/// host outputs corresponds to the paths starting at <tt>sources[i]</tt>. Returns the time spent
+/// on the device, in milliseconds.
+inline float sparse_shortest_paths(const csr_graph&                 graph,
+                                   const std::vector<unsigned int>& sources,
+                                   const unsigned int               batch_size,
+                                   const unsigned int               delta,
+                                   unsigned int*                    distance_matrix,
+                                   unsigned int*                    next_matrix)
+{
+    // Number of threads in each kernel block and number of blocks used to relax each frontier.
+    constexpr unsigned int block_size   = 256;
+    constexpr unsigned int relax_blocks = 64;
+
+    const unsigned int nodes        = graph.nodes;
+    const size_t       batch_values = static_cast<size_t>(batch_size) * nodes;
+
+    // Allocate device memory for the graph and the state of a batch of sources.
+    unsigned int*       d_csr_row_ptr;
+    unsigned int*       d_csr_col_ind;
+    unsigned int*       d_csr_val;
+    unsigned int*       d_sources;
+    unsigned long long* d_tentative;
+    unsigned int*       d_pending;
+    unsigned int*       d_frontier;
+    unsigned int*       d_frontier_size;
+    unsigned int*       d_bucket_end;
+    unsigned int*       d_next_distance;
+    unsigned int*       d_active_sources;
+    unsigned int*       d_distance_matrix;
+    unsigned int*       d_next_matrix;
+
+    HIP_CHECK(hipMalloc(&d_csr_row_ptr, sizeof(unsigned int) * (nodes + 1)));
+    HIP_CHECK(hipMalloc(&d_csr_col_ind, sizeof(unsigned int) * graph.edges()));
+    HIP_CHECK(hipMalloc(&d_csr_val, sizeof(unsigned int) * graph.edges()));
+    HIP_CHECK(hipMalloc(&d_sources, sizeof(unsigned int) * sources.size()));
+    HIP_CHECK(hipMalloc(&d_tentative, sizeof(unsigned long long) * batch_values));
+    HIP_CHECK(hipMalloc(&d_pending, sizeof(unsigned int) * batch_values));
+    HIP_CHECK(hipMalloc(&d_frontier, sizeof(unsigned int) * batch_values));
+    HIP_CHECK(hipMalloc(&d_frontier_size, sizeof(unsigned int) * batch_size));
+    HIP_CHECK(hipMalloc(&d_bucket_end, sizeof(unsigned int) * batch_size));
+    HIP_CHECK(hipMalloc(&d_next_distance, sizeof(unsigned int) * batch_size));
+    HIP_CHECK(hipMalloc(&d_active_sources, sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc(&d_distance_matrix, sizeof(unsigned int) * batch_values));
+    HIP_CHECK(hipMalloc(&d_next_matrix, sizeof(unsigned int) * batch_values));
+
+    HIP_CHECK(hipMemcpy(d_csr_row_ptr,
+                        graph.csr_row_ptr.data(),
+                        sizeof(unsigned int) * (nodes + 1),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_csr_col_ind,
+                        graph.csr_col_ind.data(),
+                        sizeof(unsigned int) * graph.edges(),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_csr_val,
+                        graph.csr_val.data(),
+                        sizeof(unsigned int) * graph.edges(),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_sources,
+                        sources.data(),
+                        sizeof(unsigned int) * sources.size(),
+                        hipMemcpyHostToDevice));
+
+    // Create events to measure the execution time of the kernels.
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+    float kernel_time{};
+
+    for(size_t first = 0; first < sources.size(); first += batch_size)
+    {
+        const unsigned int batch
+            = static_cast<unsigned int>(std::min<size_t>(batch_size, sources.size() - first));
+        const dim3 node_grid_dim(ceiling_div(nodes, block_size), batch);
+        const dim3 relax_grid_dim(relax_blocks, batch);
+
+        HIP_CHECK(hipEventRecord(start, hipStreamDefault));
+
+        delta_stepping_init_kernel<<<node_grid_dim, block_size, 0, hipStreamDefault>>>(
+            d_sources + first,
+            d_tentative,
+            d_pending,
+            d_bucket_end,
+            d_next_distance,
+            d_frontier_size,
+            nodes,
+            delta);
+        HIP_CHECK(hipGetLastError());
+
+        // Process buckets until no source of the batch has pending nodes. The only synchronization
+        // with the host per iteration is the copy of the number of active sources.
+        unsigned int active_sources = batch;
+        while(active_sources > 0)
+        {
+            delta_stepping_compact_kernel<block_size>
+                <<<node_grid_dim, block_size, 0, hipStreamDefault>>>(d_tentative,
+                                                                     d_pending,
+                                                                     d_bucket_end,
+                                                                     d_next_distance,
+                                                                     d_frontier,
+                                                                     d_frontier_size,
+                                                                     nodes);
+            HIP_CHECK(hipGetLastError());
+
+            delta_stepping_relax_kernel<<<relax_grid_dim, block_size, 0, hipStreamDefault>>>(
+                d_csr_row_ptr,
+                d_csr_col_ind,
+                d_csr_val,
+                d_tentative,
+                d_pending,
+                d_frontier,
+                d_frontier_size,
+                nodes);
+            HIP_CHECK(hipGetLastError());
+
+            HIP_CHECK(hipMemsetAsync(d_active_sources, 0, sizeof(unsigned int), hipStreamDefault));
+            delta_stepping_advance_kernel<<<ceiling_div(batch, block_size),
+                                            block_size,
+                                            0,
+                                            hipStreamDefault>>>(d_bucket_end,
+                                                                d_next_distance,
+                                                                d_frontier_size,
+                                                                d_active_sources,
+                                                                batch,
+                                                                delta);
+            HIP_CHECK(hipGetLastError());
+
+            HIP_CHECK(hipMemcpy(&active_sources,
+                                d_active_sources,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+        }
+
+        delta_stepping_output_kernel<<<node_grid_dim, block_size, 0, hipStreamDefault>>>(
+            d_sources + first,
+            d_tentative,
+            d_distance_matrix,
+            d_next_matrix,
+            nodes);
+        HIP_CHECK(hipGetLastError());
+
+        HIP_CHECK(hipEventRecord(stop, hipStreamDefault));
+        HIP_CHECK(hipEventSynchronize(stop));
+
+        float kernel_ms{};
+        HIP_CHECK(hipEventElapsedTime(&kernel_ms, start, stop));
+        kernel_time += kernel_ms;
+
+        // Copy the rows of this batch back to the host.
+        HIP_CHECK(hipMemcpy(distance_matrix + first * nodes,
+                            d_distance_matrix,
+                            sizeof(unsigned int) * batch * nodes,
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(next_matrix + first * nodes,
+                            d_next_matrix,
+                            sizeof(unsigned int) * batch * nodes,
+                            hipMemcpyDeviceToHost));
+    }
+
+    // Free events and device memory.
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipFree(d_csr_row_ptr));
+    HIP_CHECK(hipFree(d_csr_col_ind));
+    HIP_CHECK(hipFree(d_csr_val));
+    HIP_CHECK(hipFree(d_sources));
+    HIP_CHECK(hipFree(d_tentative));
+    HIP_CHECK(hipFree(d_pending));
+    HIP_CHECK(hipFree(d_frontier));
+    HIP_CHECK(hipFree(d_frontier_size));
+    HIP_CHECK(hipFree(d_bucket_end));
+    HIP_CHECK(hipFree(d_next_distance));
+    HIP_CHECK(hipFree(d_active_sources));
+    HIP_CHECK(hipFree(d_distance_matrix));
+    HIP_CHECK(hipFree(d_next_matrix));
+
+    return kernel_time;
+}
+
+/// \brief Reference CPU implementation (Dijkstra's algorithm) of the shortest paths from \p source
+/// to every node of \p graph, for results verification.
+inline std::vector<unsigned int> dijkstra_reference(const csr_graph& graph, const unsigned int source)
+{
+    using queue_entry = std::pair<unsigned int, unsigned int>;
+
+    std::vector<unsigned int> distance(graph.nodes, infinite_distance);
+    std::priority_queue<queue_entry, std::vector<queue_entry>, std::greater<queue_entry>> queue;
+
+    distance[source] = 0;
+    queue.emplace(0, source);
+    while(!queue.empty())
+    {
+        const auto [d_x, x] = queue.top();
+        queue.pop();
+        if(d_x > distance[x])
+        {
+            continue;
+        }
+        for(unsigned int e = graph.csr_row_ptr[x]; e < graph.csr_row_ptr[x + 1]; ++e)
+        {
+            const unsigned int y     = graph.csr_col_ind[e];
+            const unsigned int d_x_y = d_x + graph.csr_val[e];
+            if(d_x_y < distance[y])
+            {
+                distance[y] = d_x_y;
+                queue.emplace(d_x_y, y);
+            }
+        }
+    }
+    return distance;
+}
+
+/// \brief Returns the weight of the lightest edge (x,y) of \p graph, or \p infinite_distance if
+/// there is no such edge.
+inline unsigned int
+    edge_weight(const csr_graph& graph, const unsigned int x, const unsigned int y)
+{
+    unsigned int weight = infinite_distance;
+    for(unsigned int e = graph.csr_row_ptr[x]; e < graph.csr_row_ptr[x + 1]; ++e)
+    {
+        if(graph.csr_col_ind[e] == y)
+        {
+            weight = std::min(weight, graph.csr_val[e]);
+        }
+    }
+    return weight;
+}
+
+#endif // APPLICATIONS_FLOYD_WARSHALL_SPARSE_SHORTEST_PATHS_HPP
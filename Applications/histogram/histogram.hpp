@@ -0,0 +1,989 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef APPLICATIONS_HISTOGRAM_HISTOGRAM_HPP
+#define APPLICATIONS_HISTOGRAM_HISTOGRAM_HPP
+
+#include "example_utils.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/// \brief Number of threads per block of the private bins histogram kernels.
+constexpr unsigned int histogram_private_block_size = 128;
+
+/// \brief Number of values counted by each thread of the private bins histogram kernels, used to
+/// derive the number of blocks launched. The byte kernel has <tt>unsigned char</tt> counters, so
+/// a thread must not count more than 255 values.
+constexpr unsigned int histogram_private_items_per_thread = 255;
+
+/// \brief Number of values that a private counter of type \p Counter can count before it must be
+/// flushed.
+template<typename Counter>
+constexpr unsigned int histogram_counter_limit = static_cast<Counter>(~Counter(0));
+
+/// \brief Number of threads per block of the generic histogram kernels.
+constexpr unsigned int histogram_block_size = 256;
+
+/// \brief Number of values counted by each thread of the generic histogram kernel, used to
+/// derive the number of blocks launched.
+constexpr unsigned int histogram_items_per_thread = 64;
+
+/// \brief Maximum number of blocks of the generic histogram kernel. Each block writes its own
+/// bins, so this bounds the temporary storage and the work of the merge.
+constexpr unsigned int histogram_max_blocks = 1024;
+
+/// \brief Maximum number of bins that are accumulated in shared memory. 48 KiB of shared memory
+/// per block is available on every supported device without opting in.
+constexpr unsigned int histogram_max_shared_bins = 48 * 1024 / sizeof(unsigned int);
+
+/// \brief Maximum number of bins of the private bins kernel with counters of type \p Counter,
+/// which needs a counter per bin and thread plus an accumulator per bin in shared memory.
+template<typename Counter>
+constexpr unsigned int histogram_max_private_bins
+    = 48 * 1024 / (histogram_private_block_size * sizeof(Counter) + sizeof(unsigned int));
+
+/// \brief Number of values of the input sampled to select a histogram strategy.
+constexpr unsigned int histogram_sample_size = 4096;
+
+/// \brief The ways in which the values of a block can be counted.
+enum class histogram_strategy
+{
+    /// Byte counters private to each thread in shared memory. No atomics, so it is insensitive
+    /// to skew, but the counters of all threads must be summed every 255 values.
+    private_bins,
+    /// A copy of the bins per warp in shared memory, updated with atomics. Only the threads of a
+    /// warp contend for a bin.
+    warp_atomics,
+    /// A copy of the bins per block in shared memory, updated with atomics. If the bins do not fit
+    /// in shared memory, each block counts a range of bins that fits and adds it to the final
+    /// bins with global atomics.
+    block_atomics,
+    /// Atomics directly on the final bins in global memory. No copies to clear and merge, but
+    /// contention for a bin serializes the whole device.
+    global_atomics
+};
+
+/// \brief Returns the name of \p strategy.
+inline const char* histogram_strategy_name(const histogram_strategy strategy)
+{
+    switch(strategy)
+    {
+        case histogram_strategy::private_bins: return "private bins";
+        case histogram_strategy::warp_atomics: return "warp atomics";
+        case histogram_strategy::block_atomics: return "block atomics";
+        case histogram_strategy::global_atomics: return "global atomics";
+    }
+    return "";
+}
+
+/// \brief Maps each byte to the bin of its value. Selects the bank conflict optimized byte
+/// histogram kernel.
+struct byte_bin_mapping
+{
+    static constexpr unsigned int bin_count = 256;
+
+    __host__ __device__ unsigned int operator()(const unsigned char value) const
+    {
+        return value;
+    }
+};
+
+/// \brief Maps the values of <tt>[lower, upper)</tt> to \p bins bins of equal width. Values out
+/// of the range are mapped to \p bins, that is, they are not counted.
+template<typename T>
+struct range_bin_mapping
+{
+    T            lower;
+    T            upper;
+    unsigned int bins;
+
+    __host__ __device__ unsigned int operator()(const T value) const
+    {
+        if(!(value >= lower && value < upper))
+        {
+            return bins;
+        }
+        if constexpr(std::is_integral<T>::value)
+        {
+            // Compute in 64 bits so that (value - lower) * bins cannot overflow.
+            return static_cast<unsigned int>(static_cast<unsigned long long>(value - lower) * bins
+                                             / static_cast<unsigned long long>(upper - lower));
+        }
+        else
+        {
+            const unsigned int bin = static_cast<unsigned int>(
+                (static_cast<double>(value) - lower) / (static_cast<double>(upper) - lower) * bins);
+            return bin < bins ? bin : bins - 1;
+        }
+    }
+};
+
+/// \brief Maps unsigned integers of \p bits bits, such as the samples of 12-bit or 16-bit
+/// sensors, to bins of <tt>2^shift</tt> consecutive values. There are <tt>2^(bits - shift)</tt>
+/// bins, and larger values are not counted.
+template<typename T>
+struct bits_bin_mapping
+{
+    unsigned int bits;
+    unsigned int shift;
+
+    __host__ __device__ unsigned int bin_count() const
+    {
+        return 1u << (bits - shift);
+    }
+
+    __host__ __device__ unsigned int operator()(const T value) const
+    {
+        const unsigned long long wide_value = value;
+        return wide_value >> bits ? bin_count() : static_cast<unsigned int>(wide_value >> shift);
+    }
+};
+
+/// \brief Maps each channel of RGBA8 pixels to 256 bins of its own: the bins of channel c are
+/// <tt>[256 * c, 256 * (c + 1))</tt>, so the four histograms are computed in a single pass.
+struct rgba8_bin_mapping
+{
+    static constexpr unsigned int channels  = 4;
+    static constexpr unsigned int bin_count = channels * 256;
+
+    __host__ __device__ unsigned int operator()(const uchar4       pixel,
+                                                const unsigned int channel) const
+    {
+        const unsigned char component = channel == 0   ? pixel.x
+                                        : channel == 1 ? pixel.y
+                                        : channel == 2 ? pixel.z
+                                                       : pixel.w;
+        return channel * 256 + component;
+    }
+};
+
+/// \brief Number of channels of the values mapped by \p Mapping. A mapping with a static
+/// \p channels member maps each value to one bin per channel, with a call operator that takes the
+/// value and the channel. The bins of the channels must be disjoint. Other mappings have a
+/// single channel.
+template<typename Mapping, typename = void>
+struct histogram_channels : std::integral_constant<unsigned int, 1>
+{};
+
+template<typename Mapping>
+struct histogram_channels<Mapping, std::void_t<decltype(Mapping::channels)>>
+    : std::integral_constant<unsigned int, Mapping::channels>
+{};
+
+/// \brief Calls \p count with the bin of \p value in each channel of \p mapping, unless it is
+/// outside of <tt>[0, bin_count)</tt>.
+template<typename Mapping, typename T, typename F>
+__host__ __device__ inline void
+    for_each_bin(const Mapping& mapping, const T& value, const unsigned int bin_count, F&& count)
+{
+    for(unsigned int channel = 0; channel < histogram_channels<Mapping>::value; ++channel)
+    {
+        unsigned int bin;
+        if constexpr(histogram_channels<Mapping>::value == 1)
+        {
+            bin = mapping(value);
+        }
+        else
+        {
+            bin = mapping(value, channel);
+        }
+        if(bin < bin_count)
+        {
+            count(bin);
+        }
+    }
+}
+
+/// \brief Calculates the 256-sized bin histogram for a block.
+__global__ void histogram256_block(const unsigned char* data,
+                                   const size_t         size,
+                                   unsigned int*        block_bins,
+                                   const int            items_per_thread)
+{
+    const int thread_id  = threadIdx.x;
+    const int block_id   = blockIdx.x;
+    const int block_size = blockDim.x;
+    const int bin_size   = 256;
+
+    // If thread_bins was an array of unsigned int, thread_bins could be
+    // clustered by thread to reduce banking conflicts:
+    // | t0 ... t128 | t0 ... t128 | ... | t0 ... t128 |
+    // |    bin0     |    bin1     | ... |    bin255   |
+    // Thread bins is of size: bin_size * block_size.
+    extern __shared__ unsigned char thread_bins[];
+
+    // However, we need to use unsigned char to save space, which is smaller
+    // than 32-bit word unit stored per bank.  We can shuffle thread_id such
+    // that  a wave  front  iterates through  thread_bins  with  a stride of
+    // 4 elements (32-bits total). Example with 128 threads per block:
+    //   0b0000_0000_0AAB_BBBBB into (   thread_id)
+    //   0b0000_0000_0BBB_BBBAA      (sh_thread_id)
+    // sh_thread_id is in the range [0; block_size)
+
+    // If we assume that block_size is a power of two, then we can get the
+    // length of B by finding the first '1' bit with '__ffs'.
+    const int b_bits_length = __ffs(block_size) - 3;
+    const int sh_thread_id
+        = (thread_id & (1 << b_bits_length) - 1) << 2 | (thread_id >> b_bits_length);
+
+    // Initialize 'thread_bins' to 0
+    for(int i = 0; i < bin_size; ++i)
+    {
+        thread_bins[i + bin_size * sh_thread_id] = 0;
+    }
+    __syncthreads();
+
+    // The last block may be partially filled, so only count the items inside the input.
+    const size_t first
+        = (static_cast<size_t>(block_id) * block_size + thread_id) * items_per_thread;
+    const size_t remaining = first < size ? size - first : 0;
+    const int    items     = remaining < size_t(items_per_thread) ? static_cast<int>(remaining)
+                                                                   : items_per_thread;
+    for(int i = 0; i < items; i++)
+    {
+        const unsigned int value = data[first + i];
+        thread_bins[value * block_size + sh_thread_id]++;
+    }
+    __syncthreads();
+
+    // Join the generated 256 bins from 128 threads by letting each thread sum 256 elements from
+    // 2 bins.
+    const int bins_per_thread = bin_size / block_size;
+    for(int i = 0; i < bins_per_thread; ++i)
+    {
+        // bin_sh_id is in the range [0; bin_size)
+        const int bin_sh_id = i * block_size + sh_thread_id;
+
+        // Accumulate bins.
+        unsigned int bin_acc = 0;
+        for(int j = 0; j < block_size; ++j)
+        {
+            // Sum the result from the j-th thread from the 'block_size'-sized 'bin_id'th bin.
+            bin_acc += thread_bins[bin_sh_id * block_size + j];
+        }
+
+        block_bins[block_id * bin_size + bin_sh_id] = bin_acc;
+    }
+}
+
+/// \brief Calculates the histogram of the values processed by a block in shared memory, and
+/// writes it to the <tt>bin_count</tt>-sized bins of the block in \p block_bins. The blocks of
+/// the grid stride over the input, so any input size can be processed by any number of blocks.
+template<typename T, typename Mapping>
+__global__ void histogram_shared_block(const T*           data,
+                                       const size_t       size,
+                                       const Mapping      mapping,
+                                       const unsigned int bin_count,
+                                       unsigned int*      block_bins)
+{
+    extern __shared__ unsigned int shared_bins[];
+
+    for(unsigned int bin = threadIdx.x; bin < bin_count; bin += blockDim.x)
+    {
+        shared_bins[bin] = 0;
+    }
+    __syncthreads();
+
+    const size_t stride = static_cast<size_t>(gridDim.x) * blockDim.x;
+    for(size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x; i < size;
+        i += stride)
+    {
+        for_each_bin(mapping,
+                     data[i],
+                     bin_count,
+                     [&](const unsigned int bin) { atomicAdd(&shared_bins[bin], 1u); });
+    }
+    __syncthreads();
+
+    unsigned int* bins = block_bins + static_cast<size_t>(blockIdx.x) * bin_count;
+    for(unsigned int bin = threadIdx.x; bin < bin_count; bin += blockDim.x)
+    {
+        bins[bin] = shared_bins[bin];
+    }
+}
+
+/// \brief Calculates the histogram of the values processed by a block with counters of type
+/// \p Counter private to each thread, and writes it to the <tt>bin_count</tt>-sized bins of the
+/// block in \p block_bins. The counters are laid out as in \p histogram256_block, and the
+/// threads are shuffled so that a wavefront accesses counters in different 32-bit words. The
+/// threads of the grid stride over the input in rounds of <tt>histogram_counter_limit<Counter></tt>
+/// values per thread. After each round, the counters are summed into a 32-bit accumulator per bin
+/// and cleared, so they cannot overflow.
+template<typename Counter, typename T, typename Mapping>
+__global__ void histogram_private_block(const T*           data,
+                                        const size_t       size,
+                                        const Mapping      mapping,
+                                        const unsigned int bin_count,
+                                        unsigned int*      block_bins)
+{
+    const int thread_id  = threadIdx.x;
+    const int block_size = blockDim.x;
+
+    // The counters of the threads are followed by the accumulators of the block. The size of the
+    // counters is a multiple of 4 * block_size bytes, so the accumulators are aligned.
+    extern __shared__ unsigned char shared_memory[];
+    Counter*      thread_bins = reinterpret_cast<Counter*>(shared_memory);
+    unsigned int* block_acc   = reinterpret_cast<unsigned int*>(
+        shared_memory + sizeof(Counter) * bin_count * block_size);
+
+    // Each 32-bit word holds 1 << shift counters. See histogram256_block for a description of the
+    // shuffle of the threads.
+    constexpr int shift         = sizeof(Counter) == 1 ? 2 : sizeof(Counter) == 2 ? 1 : 0;
+    const int     b_bits_length = __ffs(block_size) - 1 - shift;
+    const int     sh_thread_id
+        = (thread_id & (1 << b_bits_length) - 1) << shift | (thread_id >> b_bits_length);
+
+    for(unsigned int bin = thread_id; bin < bin_count; bin += block_size)
+    {
+        block_acc[bin] = 0;
+    }
+
+    constexpr unsigned int items_per_thread = histogram_counter_limit<Counter>;
+    const size_t           stride           = static_cast<size_t>(gridDim.x) * block_size;
+    const size_t           round_size       = stride * items_per_thread;
+    // The rounds start at the same value for all threads of a block, so that they all reach the
+    // barriers.
+    for(size_t block_first = static_cast<size_t>(blockIdx.x) * block_size; block_first < size;
+        block_first += round_size)
+    {
+        const size_t first = block_first + thread_id;
+        for(unsigned int bin = 0; bin < bin_count; ++bin)
+        {
+            thread_bins[bin * block_size + sh_thread_id] = 0;
+        }
+
+        // Consecutive threads read consecutive values.
+        for(unsigned int i = 0; i < items_per_thread; ++i)
+        {
+            const size_t index = first + i * stride;
+            if(index >= size)
+            {
+                break;
+            }
+            for_each_bin(mapping,
+                         data[index],
+                         bin_count,
+                         [&](const unsigned int bin)
+                         { thread_bins[bin * block_size + sh_thread_id]++; });
+        }
+        __syncthreads();
+
+        // Sum the counters of each bin. Each thread starts at a different counter so that the
+        // threads of a warp read different banks.
+        for(unsigned int bin = thread_id; bin < bin_count; bin += block_size)
+        {
+            unsigned int bin_acc = 0;
+            for(int j = 0; j < block_size; ++j)
+            {
+                bin_acc += thread_bins[bin * block_size + ((j + thread_id) & (block_size - 1))];
+            }
+            block_acc[bin] += bin_acc;
+        }
+        __syncthreads();
+    }
+
+    unsigned int* bins = block_bins + static_cast<size_t>(blockIdx.x) * bin_count;
+    for(unsigned int bin = thread_id; bin < bin_count; bin += block_size)
+    {
+        bins[bin] = block_acc[bin];
+    }
+}
+
+/// \brief Calculates the histogram of the values processed by a block with a copy of the bins
+/// per warp in shared memory, and writes it to the <tt>bin_count</tt>-sized bins of the block in
+/// \p block_bins. Only the threads of the same warp contend for the atomics on a bin.
+template<typename T, typename Mapping>
+__global__ void histogram_warp_block(const T*           data,
+                                     const size_t       size,
+                                     const Mapping      mapping,
+                                     const unsigned int bin_count,
+                                     unsigned int*      block_bins)
+{
+    extern __shared__ unsigned int warp_bins[];
+
+    const unsigned int warps = blockDim.x / warpSize;
+    for(unsigned int bin = threadIdx.x; bin < warps * bin_count; bin += blockDim.x)
+    {
+        warp_bins[bin] = 0;
+    }
+    __syncthreads();
+
+    unsigned int* bins   = warp_bins + (threadIdx.x / warpSize) * bin_count;
+    const size_t  stride = static_cast<size_t>(gridDim.x) * blockDim.x;
+    for(size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x; i < size;
+        i += stride)
+    {
+        for_each_bin(mapping,
+                     data[i],
+                     bin_count,
+                     [&](const unsigned int bin) { atomicAdd(&bins[bin], 1u); });
+    }
+    __syncthreads();
+
+    // Sum the copies of the warps.
+    for(unsigned int bin = threadIdx.x; bin < bin_count; bin += blockDim.x)
+    {
+        unsigned int bin_acc = 0;
+        for(unsigned int warp = 0; warp < warps; ++warp)
+        {
+            bin_acc += warp_bins[warp * bin_count + bin];
+        }
+        block_bins[static_cast<size_t>(blockIdx.x) * bin_count + bin] = bin_acc;
+    }
+}
+
+/// \brief Calculates the histogram of the input directly in the (zero-initialized) \p bins in
+/// global memory. Used when the bins do not fit in shared memory.
+template<typename T, typename Mapping, typename Bin>
+__global__ void histogram_global(const T*           data,
+                                 const size_t       size,
+                                 const Mapping      mapping,
+                                 const unsigned int bin_count,
+                                 Bin*               bins)
+{
+    const size_t stride = static_cast<size_t>(gridDim.x) * blockDim.x;
+    for(size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x; i < size;
+        i += stride)
+    {
+        for_each_bin(mapping,
+                     data[i],
+                     bin_count,
+                     [&](const unsigned int bin) { atomicAdd(&bins[bin], Bin(1)); });
+    }
+}
+
+/// \brief Calculates the histogram of the values processed by a block for the range of
+/// \p histogram_max_shared_bins bins selected by <tt>blockIdx.y</tt> in shared memory, and adds
+/// it to the (zero-initialized) \p bins with global atomics. Used when the bins do not fit in
+/// shared memory: the input is read once per range of bins, but the contention for a bin is
+/// confined to a block.
+template<typename T, typename Mapping, typename Bin>
+__global__ void histogram_partitioned_block(const T*           data,
+                                            const size_t       size,
+                                            const Mapping      mapping,
+                                            const unsigned int bin_count,
+                                            Bin*               bins)
+{
+    __shared__ unsigned int shared_bins[histogram_max_shared_bins];
+
+    const unsigned int first_bin = blockIdx.y * histogram_max_shared_bins;
+    const unsigned int range     = min(bin_count - first_bin, histogram_max_shared_bins);
+
+    for(unsigned int bin = threadIdx.x; bin < range; bin += blockDim.x)
+    {
+        shared_bins[bin] = 0;
+    }
+    __syncthreads();
+
+    const size_t stride = static_cast<size_t>(gridDim.x) * blockDim.x;
+    for(size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x; i < size;
+        i += stride)
+    {
+        for_each_bin(mapping,
+                     data[i],
+                     bin_count,
+                     [&](const unsigned int bin)
+                     {
+                         // Bins below first_bin wrap around to large values.
+                         if(bin - first_bin < range)
+                         {
+                             atomicAdd(&shared_bins[bin - first_bin], 1u);
+                         }
+                     });
+    }
+    __syncthreads();
+
+    for(unsigned int bin = threadIdx.x; bin < range; bin += blockDim.x)
+    {
+        if(shared_bins[bin] != 0)
+        {
+            atomicAdd(&bins[first_bin + bin], Bin(shared_bins[bin]));
+        }
+    }
+}
+
+/// \brief Sums the <tt>bin_count</tt>-sized bins of the \p block_count blocks into \p bins, or
+/// adds them to \p bins if \p accumulate is set. Each thread sums one bin, so consecutive threads
+/// read consecutive bins of each block.
+template<typename Bin>
+__global__ void histogram_merge(const unsigned int* block_bins,
+                                const unsigned int  block_count,
+                                const unsigned int  bin_count,
+                                Bin*                bins,
+                                const bool          accumulate)
+{
+    const unsigned int bin = blockIdx.x * blockDim.x + threadIdx.x;
+    if(bin >= bin_count)
+    {
+        return;
+    }
+
+    Bin bin_acc = accumulate ? bins[bin] : 0;
+    for(unsigned int block = 0; block < block_count; ++block)
+    {
+        bin_acc += block_bins[static_cast<size_t>(block) * bin_count + bin];
+    }
+    bins[bin] = bin_acc;
+}
+
+/// \brief Writes to \p samples the bins of \p sample_count values spread evenly over the input,
+/// one per channel of \p mapping. Bins outside of <tt>[0, bin_count)</tt> are written as
+/// \p bin_count.
+template<typename T, typename Mapping>
+__global__ void histogram_sample(const T*           data,
+                                 const size_t       size,
+                                 const Mapping      mapping,
+                                 const unsigned int bin_count,
+                                 const unsigned int sample_count,
+                                 unsigned int*      samples)
+{
+    constexpr unsigned int channels = histogram_channels<Mapping>::value;
+
+    const unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if(i < sample_count)
+    {
+        for(unsigned int channel = 0; channel < channels; ++channel)
+        {
+            samples[i * channels + channel] = bin_count;
+        }
+        unsigned int channel = 0;
+        for_each_bin(mapping,
+                     data[size / sample_count * i],
+                     bin_count,
+                     [&](const unsigned int bin) { samples[i * channels + channel++] = bin; });
+    }
+}
+
+/// \brief Statistics of the bins of a sample of the input.
+struct histogram_sample_stats
+{
+    /// Number of sampled values mapped to a bin.
+    unsigned int counted = 0;
+    /// Number of distinct bins of the sampled values.
+    unsigned int distinct_bins = 0;
+    /// Number of sampled values in the most frequent bin.
+    unsigned int max_bin_count = 0;
+};
+
+/// \brief Computes the statistics of the sampled \p samples bins.
+inline histogram_sample_stats compute_histogram_sample_stats(std::vector<unsigned int> samples,
+                                                             const unsigned int bin_count)
+{
+    histogram_sample_stats stats;
+    std::sort(samples.begin(), samples.end());
+    for(size_t i = 0; i < samples.size() && samples[i] < bin_count;)
+    {
+        size_t j = i;
+        while(j < samples.size() && samples[j] == samples[i])
+        {
+            ++j;
+        }
+        const unsigned int run = static_cast<unsigned int>(j - i);
+        stats.counted += run;
+        stats.distinct_bins += 1;
+        stats.max_bin_count = std::max(stats.max_bin_count, run);
+        i                   = j;
+    }
+    return stats;
+}
+
+/// \brief Fraction of the values in the most frequent bin from which the input is considered
+/// heavily skewed: most atomics of a warp would hit the same bin.
+constexpr double histogram_heavy_skew = 0.25;
+
+/// \brief Ratio between the fraction of values in the most frequent bin and the fraction
+/// expected if the values were uniform over the sampled bins, from which the input is
+/// considered skewed.
+constexpr double histogram_skew_ratio = 4.0;
+
+/// \brief Minimum fraction of the values in the most frequent bin for the input to be considered
+/// skewed. With many bins and few samples per bin, uniform inputs can exceed the skew ratio.
+constexpr double histogram_skew_min_fraction = 1.0 / 128;
+
+/// \brief Number of bins up to which the private bins are used regardless of skew: the counters
+/// of all threads are summed at most once every 255 / 64 values per thread.
+constexpr unsigned int histogram_small_bin_count = 64;
+
+/// \brief Selects the strategy to compute a histogram of \p size values into \p bin_count bins
+/// from the statistics of a sample, on a device with warps of \p warp_size threads:
+/// - so many bins compared to the input that clearing and merging the copies of the blocks costs
+///   more than the input use global atomics.
+/// - bins that do not fit in shared memory use global atomics, unless the input is skewed. Then
+///   they are counted in ranges that fit in shared memory by each block.
+/// - heavily skewed inputs and small bin counts use private bins if they fit, as they are not
+///   affected by contention.
+/// - skewed inputs use a copy of the bins per warp if they fit, to spread the contention.
+/// - other inputs use a copy of the bins per block.
+inline histogram_strategy select_histogram_strategy(const histogram_sample_stats& stats,
+                                                    const size_t                  size,
+                                                    const unsigned int            bin_count,
+                                                    const unsigned int            warp_size)
+{
+    const double max_fraction
+        = stats.counted == 0 ? 0.0 : static_cast<double>(stats.max_bin_count) / stats.counted;
+    const bool heavy_skew = max_fraction >= histogram_heavy_skew;
+    const bool skew
+        = heavy_skew
+          || (max_fraction >= histogram_skew_min_fraction
+              && max_fraction * stats.distinct_bins >= histogram_skew_ratio);
+
+    const unsigned int warps = std::max(histogram_block_size / warp_size, 1u);
+    const size_t       blocks
+        = std::min(ceiling_div(size, size_t(histogram_block_size) * histogram_items_per_thread),
+                   size_t(histogram_max_blocks));
+    if(static_cast<size_t>(bin_count) * blocks >= size)
+    {
+        return histogram_strategy::global_atomics;
+    }
+    if(bin_count > histogram_max_shared_bins)
+    {
+        return skew ? histogram_strategy::block_atomics : histogram_strategy::global_atomics;
+    }
+
+    if((heavy_skew || bin_count <= histogram_small_bin_count)
+       && bin_count <= histogram_max_private_bins<unsigned char>)
+    {
+        return histogram_strategy::private_bins;
+    }
+    if(skew && warps * bin_count <= histogram_max_shared_bins)
+    {
+        return histogram_strategy::warp_atomics;
+    }
+    return histogram_strategy::block_atomics;
+}
+
+/// \brief Returns the number of blocks launched by \p histogram with \p strategy for an input of
+/// \p size values mapped with \p Mapping.
+template<typename Mapping>
+unsigned int histogram_block_count(const size_t size, const histogram_strategy strategy)
+{
+    if(strategy == histogram_strategy::private_bins)
+    {
+        const size_t items_per_block
+            = size_t(histogram_private_block_size) * histogram_private_items_per_thread;
+        const size_t blocks = std::max(ceiling_div(size, items_per_block), size_t(1));
+        // The byte kernel does not stride over the input, every other kernel does.
+        return static_cast<unsigned int>(std::is_same<Mapping, byte_bin_mapping>::value
+                                             ? blocks
+                                             : std::min(blocks, size_t(histogram_max_blocks)));
+    }
+
+    const size_t items_per_block = size_t(histogram_block_size) * histogram_items_per_thread;
+    return static_cast<unsigned int>(std::clamp(ceiling_div(size, items_per_block),
+                                                size_t(1),
+                                                size_t(histogram_max_blocks)));
+}
+
+/// \brief Returns the number of ranges of bins counted by \p histogram_partitioned_block.
+inline unsigned int histogram_bin_partitions(const unsigned int bin_count)
+{
+    return ceiling_div(bin_count, histogram_max_shared_bins);
+}
+
+/// \brief Returns the number of values of the temporary storage needed by \p histogram, with any
+/// strategy.
+template<typename Mapping>
+size_t histogram_storage_size(const size_t size, const unsigned int bin_count)
+{
+    const size_t sample_size = size_t(histogram_sample_size) * histogram_channels<Mapping>::value;
+    if(bin_count > histogram_max_shared_bins)
+    {
+        // Only the sample is stored, the blocks add their bins to the final ones.
+        return sample_size;
+    }
+
+    const size_t blocks
+        = std::max(histogram_block_count<Mapping>(size, histogram_strategy::private_bins),
+                   histogram_block_count<Mapping>(size, histogram_strategy::block_atomics));
+    return std::max(blocks * bin_count, sample_size);
+}
+
+/// \brief Computes on the device the histogram of the \p size values of \p d_data into the
+/// \p bin_count bins of \p d_bins with \p strategy. Every value is mapped to a bin with
+/// \p mapping (or to a bin per channel, see \p histogram_channels), and values mapped outside of
+/// <tt>[0, bin_count)</tt> are not counted. If the bins fit in shared memory and global atomics
+/// are not used, each block accumulates its histogram in shared memory to \p d_storage (of
+/// \p histogram_storage_size values), and the histograms of the blocks are merged on the device,
+/// so only the final bins must be copied back to the host. Bytes mapped with
+/// \p byte_bin_mapping use the bank conflict optimized \p histogram256_block kernel for private
+/// bins. Other private bins have 16-bit counters if the input is large enough that each thread
+/// counts more than 255 values and they fit in shared memory, and byte counters otherwise.
+/// \p warp_size is the number of threads of a warp of the device. The bins are
+/// <tt>unsigned int</tt> or <tt>unsigned long long</tt>. If \p accumulate is set, the histogram
+/// is added to the current values of \p d_bins, so a histogram can be computed over several
+/// chunks of the input.
+template<typename T, typename Mapping, typename Bin>
+void histogram(const T*                 d_data,
+               const size_t             size,
+               const Mapping            mapping,
+               const unsigned int       bin_count,
+               const histogram_strategy strategy,
+               const unsigned int       warp_size,
+               Bin*                     d_bins,
+               unsigned int*            d_storage,
+               hipStream_t              stream,
+               const bool               accumulate = false)
+{
+    const unsigned int blocks = histogram_block_count<Mapping>(size, strategy);
+
+    switch(strategy)
+    {
+        case histogram_strategy::private_bins:
+            if constexpr(std::is_same<Mapping, byte_bin_mapping>::value)
+            {
+                static_assert(std::is_same<T, unsigned char>::value, "byte_bin_mapping maps bytes");
+                histogram256_block<<<blocks,
+                                     histogram_private_block_size,
+                                     byte_bin_mapping::bin_count * histogram_private_block_size,
+                                     stream>>>(d_data,
+                                               size,
+                                               d_storage,
+                                               histogram_private_items_per_thread);
+            }
+            else
+            {
+                const size_t threads = size_t(blocks) * histogram_private_block_size;
+                if(size > threads * histogram_private_items_per_thread
+                   && bin_count <= histogram_max_private_bins<unsigned short>)
+                {
+                    const size_t shared_size
+                        = bin_count
+                          * (histogram_private_block_size * sizeof(unsigned short)
+                             + sizeof(unsigned int));
+                    histogram_private_block<unsigned short>
+                        <<<blocks, histogram_private_block_size, shared_size, stream>>>(d_data,
+                                                                                       size,
+                                                                                       mapping,
+                                                                                       bin_count,
+                                                                                       d_storage);
+                }
+                else
+                {
+                    const size_t shared_size
+                        = bin_count * (histogram_private_block_size + sizeof(unsigned int));
+                    histogram_private_block<unsigned char>
+                        <<<blocks, histogram_private_block_size, shared_size, stream>>>(d_data,
+                                                                                       size,
+                                                                                       mapping,
+                                                                                       bin_count,
+                                                                                       d_storage);
+                }
+            }
+            break;
+        case histogram_strategy::warp_atomics:
+            histogram_warp_block<<<blocks,
+                                   histogram_block_size,
+                                   sizeof(unsigned int) * bin_count
+                                       * std::max(histogram_block_size / warp_size, 1u),
+                                   stream>>>(d_data, size, mapping, bin_count, d_storage);
+            break;
+        case histogram_strategy::block_atomics:
+            if(bin_count > histogram_max_shared_bins)
+            {
+                if(!accumulate)
+                {
+                    HIP_CHECK(hipMemsetAsync(d_bins, 0, sizeof(Bin) * bin_count, stream));
+                }
+                histogram_partitioned_block<<<dim3(blocks, histogram_bin_partitions(bin_count)),
+                                              histogram_block_size,
+                                              0,
+                                              stream>>>(d_data, size, mapping, bin_count, d_bins);
+                HIP_CHECK(hipGetLastError());
+                return;
+            }
+            histogram_shared_block<<<blocks,
+                                     histogram_block_size,
+                                     sizeof(unsigned int) * bin_count,
+                                     stream>>>(d_data, size, mapping, bin_count, d_storage);
+            break;
+        case histogram_strategy::global_atomics:
+            if(!accumulate)
+            {
+                HIP_CHECK(hipMemsetAsync(d_bins, 0, sizeof(Bin) * bin_count, stream));
+            }
+            histogram_global<<<blocks, histogram_block_size, 0, stream>>>(d_data,
+                                                                          size,
+                                                                          mapping,
+                                                                          bin_count,
+                                                                          d_bins);
+            HIP_CHECK(hipGetLastError());
+            return;
+    }
+    HIP_CHECK(hipGetLastError());
+
+    histogram_merge<<<ceiling_div(bin_count, histogram_block_size),
+                      histogram_block_size,
+                      0,
+                      stream>>>(d_storage, blocks, bin_count, d_bins, accumulate);
+    HIP_CHECK(hipGetLastError());
+}
+
+/// \brief Returns whether \p strategy can compute a histogram of \p bin_count bins on a device
+/// with warps of \p warp_size threads.
+template<typename Mapping>
+bool histogram_strategy_supported(const histogram_strategy strategy,
+                                  const unsigned int       bin_count,
+                                  const unsigned int       warp_size)
+{
+    switch(strategy)
+    {
+        case histogram_strategy::private_bins:
+            return std::is_same<Mapping, byte_bin_mapping>::value
+                   || bin_count <= histogram_max_private_bins<unsigned char>;
+        case histogram_strategy::warp_atomics:
+            return std::max(histogram_block_size / warp_size, 1u) * bin_count
+                   <= histogram_max_shared_bins;
+        case histogram_strategy::block_atomics: return true;
+        case histogram_strategy::global_atomics: return true;
+    }
+    return false;
+}
+
+/// \brief Samples the input on the device and selects a strategy for it with
+/// \p select_histogram_strategy. Waits for \p stream, since the sample is copied to the host.
+template<typename T, typename Mapping>
+histogram_strategy sample_histogram_strategy(const T*           d_data,
+                                             const size_t       size,
+                                             const Mapping      mapping,
+                                             const unsigned int bin_count,
+                                             const unsigned int warp_size,
+                                             unsigned int*      d_storage,
+                                             hipStream_t        stream)
+{
+    if constexpr(std::is_same<Mapping, byte_bin_mapping>::value)
+    {
+        // The byte kernel has no atomics and sums its counters only once per block, so there is
+        // no need to sample the input.
+        (void)d_data, (void)mapping, (void)bin_count, (void)warp_size, (void)d_storage;
+        (void)stream;
+        return histogram_strategy::private_bins;
+    }
+    else
+    {
+        const unsigned int sample_count
+            = static_cast<unsigned int>(std::min(size, size_t(histogram_sample_size)));
+        std::vector<unsigned int> samples(sample_count * histogram_channels<Mapping>::value);
+        if(sample_count > 0)
+        {
+            histogram_sample<<<ceiling_div(sample_count, histogram_block_size),
+                               histogram_block_size,
+                               0,
+                               stream>>>(d_data, size, mapping, bin_count, sample_count, d_storage);
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipMemcpyAsync(samples.data(),
+                                     d_storage,
+                                     sizeof(unsigned int) * samples.size(),
+                                     hipMemcpyDeviceToHost,
+                                     stream));
+            HIP_CHECK(hipStreamSynchronize(stream));
+        }
+
+        return select_histogram_strategy(compute_histogram_sample_stats(samples, bin_count),
+                                         size,
+                                         bin_count,
+                                         warp_size);
+    }
+}
+
+/// \brief Returns the number of threads of a warp of the current device.
+inline unsigned int histogram_warp_size()
+{
+    int device, warp_size;
+    HIP_CHECK(hipGetDevice(&device));
+    HIP_CHECK(hipDeviceGetAttribute(&warp_size, hipDeviceAttributeWarpSize, device));
+    return static_cast<unsigned int>(warp_size);
+}
+
+/// \brief Computes on the device the histogram of the \p size values of \p d_data into the
+/// \p bin_count bins of \p d_bins, with the strategy selected by sampling the input. See the
+/// \p histogram overload with an explicit strategy for the meaning of the parameters. Returns
+/// the strategy used.
+template<typename T, typename Mapping, typename Bin>
+histogram_strategy histogram(const T*           d_data,
+                             const size_t       size,
+                             const Mapping      mapping,
+                             const unsigned int bin_count,
+                             Bin*               d_bins,
+                             unsigned int*      d_storage,
+                             hipStream_t        stream)
+{
+    const unsigned int       warp_size = histogram_warp_size();
+    const histogram_strategy strategy
+        = sample_histogram_strategy(d_data, size, mapping, bin_count, warp_size, d_storage, stream);
+    histogram(d_data, size, mapping, bin_count, strategy, warp_size, d_bins, d_storage, stream);
+    return strategy;
+}
+
+/// \brief Reference CPU implementation of the histogram, for results verification. The input is
+/// split in a range per host thread, and the histograms of the ranges are summed.
+template<typename T, typename Mapping>
+std::vector<unsigned int> histogram_reference(const std::vector<T>& data,
+                                              const Mapping         mapping,
+                                              const unsigned int    bin_count)
+{
+    const size_t thread_count = std::clamp(size_t(std::thread::hardware_concurrency()),
+                                           size_t(1),
+                                           std::max(data.size() / 65536, size_t(1)));
+
+    std::vector<std::vector<unsigned int>> thread_bins(thread_count,
+                                                       std::vector<unsigned int>(bin_count));
+    std::vector<std::thread>               threads;
+    for(size_t t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back(
+            [&, t]()
+            {
+                std::vector<unsigned int>& bins  = thread_bins[t];
+                const size_t               first = data.size() * t / thread_count;
+                const size_t               last  = data.size() * (t + 1) / thread_count;
+                for(size_t i = first; i < last; ++i)
+                {
+                    for_each_bin(mapping,
+                                 data[i],
+                                 bin_count,
+                                 [&](const unsigned int bin) { ++bins[bin]; });
+                }
+            });
+    }
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<unsigned int> bins(bin_count);
+    for(const std::vector<unsigned int>& partial_bins : thread_bins)
+    {
+        for(unsigned int bin = 0; bin < bin_count; ++bin)
+        {
+            bins[bin] += partial_bins[bin];
+        }
+    }
+    return bins;
+}
+
+#endif // APPLICATIONS_HISTOGRAM_HISTOGRAM_HPP
@@ -0,0 +1,245 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef APPLICATIONS_HISTOGRAM_HISTOGRAM_STREAM_HPP
+#define APPLICATIONS_HISTOGRAM_HISTOGRAM_STREAM_HPP
+
+#include "example_utils.hpp"
+#include "histogram.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/// \brief Amount of data processed by each stage of a streaming histogram, and the time spent
+/// in each of them.
+struct histogram_stream_stats
+{
+    size_t bytes  = 0;
+    size_t chunks = 0;
+    /// Time spent by the host reading the file.
+    double read_seconds = 0;
+    /// Time spent by the device copying the chunks from the host.
+    double copy_seconds = 0;
+    /// Time spent by the device computing the histograms of the chunks.
+    double kernel_seconds = 0;
+    /// Time from the first read to the final histogram.
+    double total_seconds = 0;
+};
+
+/// \brief A pinned host buffer and a device buffer for a chunk of the input, with the events
+/// that time its copy and its histogram.
+struct histogram_stream_slot
+{
+    unsigned char* h_chunk;
+    unsigned char* d_chunk;
+    hipEvent_t     copy_start;
+    hipEvent_t     copy_stop;
+    hipEvent_t     kernel_start;
+    hipEvent_t     kernel_stop;
+    bool           pending = false;
+};
+
+/// \brief Waits until the chunk of \p slot is processed and adds the time of its copy and its
+/// histogram to \p stats.
+inline void finish_histogram_stream_slot(histogram_stream_slot&  slot,
+                                         histogram_stream_stats& stats)
+{
+    if(!slot.pending)
+    {
+        return;
+    }
+
+    float copy_ms, kernel_ms;
+    HIP_CHECK(hipEventSynchronize(slot.kernel_stop));
+    HIP_CHECK(hipEventElapsedTime(&copy_ms, slot.copy_start, slot.copy_stop));
+    HIP_CHECK(hipEventElapsedTime(&kernel_ms, slot.kernel_start, slot.kernel_stop));
+    stats.copy_seconds += copy_ms / 1000.0;
+    stats.kernel_seconds += kernel_ms / 1000.0;
+    slot.pending = false;
+}
+
+/// \brief Computes on the device the byte histogram of the file at \p path, which may be larger
+/// than the host and device memory, into the 256 bins of \p d_bins. The bins are 64-bit, so they
+/// do not overflow for files of terabytes. The file is read in chunks of \p chunk_size bytes into
+/// a ring of \p buffer_count pinned buffers. Each chunk is copied to the device on a copy
+/// stream, and its histogram is added to \p d_bins on a compute stream once its copy is
+/// complete. The host reads the next chunks while the device copies and counts the previous
+/// ones, and a copy overlaps the histogram of the previous chunk. A buffer is only refilled after
+/// the histogram of its chunk is complete. Throws \p std::runtime_error if the file cannot be
+/// read.
+inline histogram_stream_stats stream_file_histogram(const std::string&  path,
+                                                    const size_t        chunk_size,
+                                                    const unsigned int  buffer_count,
+                                                    unsigned long long* d_bins)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if(file == nullptr)
+    {
+        throw std::runtime_error("Could not open file " + path);
+    }
+    // The chunks are read directly into the pinned buffers, without the buffering of the C
+    // library.
+    std::setvbuf(file, nullptr, _IONBF, 0);
+
+    std::vector<histogram_stream_slot> slots(buffer_count);
+    for(histogram_stream_slot& slot : slots)
+    {
+        HIP_CHECK(hipHostMalloc(&slot.h_chunk, chunk_size));
+        HIP_CHECK(hipMalloc(&slot.d_chunk, chunk_size));
+        HIP_CHECK(hipEventCreate(&slot.copy_start));
+        HIP_CHECK(hipEventCreate(&slot.copy_stop));
+        HIP_CHECK(hipEventCreate(&slot.kernel_start));
+        HIP_CHECK(hipEventCreate(&slot.kernel_stop));
+    }
+
+    // The chunks are processed one after the other on the compute stream, so they can share the
+    // temporary storage of the histogram.
+    const size_t storage_size
+        = histogram_storage_size<byte_bin_mapping>(chunk_size, byte_bin_mapping::bin_count);
+    unsigned int* d_storage;
+    HIP_CHECK(hipMalloc(&d_storage, sizeof(unsigned int) * storage_size));
+
+    hipStream_t copy_stream, compute_stream;
+    HIP_CHECK(hipStreamCreate(&copy_stream));
+    HIP_CHECK(hipStreamCreate(&compute_stream));
+
+    const unsigned int warp_size = histogram_warp_size();
+
+    histogram_stream_stats stats;
+    HostClock              read_clock;
+    HostClock              total_clock;
+    total_clock.start_timer();
+
+    HIP_CHECK(hipMemsetAsync(d_bins,
+                             0,
+                             sizeof(unsigned long long) * byte_bin_mapping::bin_count,
+                             compute_stream));
+
+    bool end_of_file = false;
+    for(size_t chunk = 0; !end_of_file; ++chunk)
+    {
+        histogram_stream_slot& slot = slots[chunk % buffer_count];
+        finish_histogram_stream_slot(slot, stats);
+
+        read_clock.start_timer();
+        const size_t size = std::fread(slot.h_chunk, 1, chunk_size, file);
+        read_clock.stop_timer();
+
+        end_of_file = size < chunk_size;
+        if(size == 0)
+        {
+            break;
+        }
+
+        HIP_CHECK(hipEventRecord(slot.copy_start, copy_stream));
+        HIP_CHECK(
+            hipMemcpyAsync(slot.d_chunk, slot.h_chunk, size, hipMemcpyHostToDevice, copy_stream));
+        HIP_CHECK(hipEventRecord(slot.copy_stop, copy_stream));
+
+        HIP_CHECK(hipStreamWaitEvent(compute_stream, slot.copy_stop, 0));
+        HIP_CHECK(hipEventRecord(slot.kernel_start, compute_stream));
+        histogram(slot.d_chunk,
+                  size,
+                  byte_bin_mapping{},
+                  byte_bin_mapping::bin_count,
+                  histogram_strategy::private_bins,
+                  warp_size,
+                  d_bins,
+                  d_storage,
+                  compute_stream,
+                  true);
+        HIP_CHECK(hipEventRecord(slot.kernel_stop, compute_stream));
+        slot.pending = true;
+
+        stats.bytes += size;
+        stats.chunks += 1;
+    }
+
+    for(histogram_stream_slot& slot : slots)
+    {
+        finish_histogram_stream_slot(slot, stats);
+    }
+    HIP_CHECK(hipStreamSynchronize(compute_stream));
+    total_clock.stop_timer();
+
+    const bool read_error = std::ferror(file) != 0;
+    std::fclose(file);
+
+    HIP_CHECK(hipStreamDestroy(copy_stream));
+    HIP_CHECK(hipStreamDestroy(compute_stream));
+    HIP_CHECK(hipFree(d_storage));
+    for(histogram_stream_slot& slot : slots)
+    {
+        HIP_CHECK(hipEventDestroy(slot.copy_start));
+        HIP_CHECK(hipEventDestroy(slot.copy_stop));
+        HIP_CHECK(hipEventDestroy(slot.kernel_start));
+        HIP_CHECK(hipEventDestroy(slot.kernel_stop));
+        HIP_CHECK(hipFree(slot.d_chunk));
+        HIP_CHECK(hipHostFree(slot.h_chunk));
+    }
+
+    if(read_error)
+    {
+        throw std::runtime_error("Could not read file " + path);
+    }
+
+    stats.read_seconds  = read_clock.get_elapsed_time();
+    stats.total_seconds = total_clock.get_elapsed_time();
+    return stats;
+}
+
+/// \brief Reference CPU implementation of the byte histogram of the file at \p path, read in
+/// chunks of \p chunk_size bytes, for results verification.
+inline std::vector<unsigned long long> file_histogram_reference(const std::string& path,
+                                                                const size_t       chunk_size)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if(file == nullptr)
+    {
+        throw std::runtime_error("Could not open file " + path);
+    }
+
+    std::vector<unsigned long long> bins(byte_bin_mapping::bin_count);
+    std::vector<unsigned char>      chunk(chunk_size);
+    size_t                          size;
+    while((size = std::fread(chunk.data(), 1, chunk_size, file)) > 0)
+    {
+        for(size_t i = 0; i < size; ++i)
+        {
+            ++bins[chunk[i]];
+        }
+    }
+
+    const bool read_error = std::ferror(file) != 0;
+    std::fclose(file);
+    if(read_error)
+    {
+        throw std::runtime_error("Could not read file " + path);
+    }
+    return bins;
+}
+
+#endif // APPLICATIONS_HISTOGRAM_HISTOGRAM_STREAM_HPP
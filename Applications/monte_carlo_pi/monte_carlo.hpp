@@ -0,0 +1,366 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef APPLICATIONS_MONTE_CARLO_PI_MONTE_CARLO_HPP
+#define APPLICATIONS_MONTE_CARLO_PI_MONTE_CARLO_HPP
+
+#include "example_utils.hpp"
+#include "hiprand_utils.hpp"
+
+#include <hipcub/block/block_reduce.hpp>
+#include <hiprand/hiprand.h>
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/// \brief Number of threads in each block of the integration kernel.
+constexpr unsigned int monte_carlo_block_size = 256;
+
+/// \brief Maximum number of blocks per integrand of the integration kernel. The threads loop over
+/// the points of a chunk beyond that.
+constexpr unsigned int monte_carlo_max_blocks = 256;
+
+/// \brief The box <tt>[lower, upper]</tt> in \p Dimensions dimensions over which a function is
+/// integrated.
+template<unsigned int Dimensions>
+struct integration_box
+{
+    float lower[Dimensions];
+    float upper[Dimensions];
+};
+
+/// \brief Samples the integration box uniformly. Maps a point of the unit cube to the box and
+/// returns the volume of the box, which is the weight of the sample.
+template<unsigned int Dimensions>
+struct uniform_sampling
+{
+    __host__ __device__ float operator()(const integration_box<Dimensions>& box,
+                                         float (&point)[Dimensions]) const
+    {
+        float volume = 1.f;
+        for(unsigned int d = 0; d < Dimensions; ++d)
+        {
+            const float width = box.upper[d] - box.lower[d];
+            point[d]          = box.lower[d] + point[d] * width;
+            volume *= width;
+        }
+        return volume;
+    }
+};
+
+/// \brief Importance sampling with a separable, piecewise-constant density. Every dimension of the
+/// box is split into \p Bins bins of equal probability, given by their \p edges as fractions of
+/// the box, so the samples are denser where the bins are narrower. Maps a point of the unit cube
+/// to the box and returns the reciprocal of the density at the sample, which is its weight. The
+/// edges are passed to the kernel as an argument, so <tt>Dimensions * (Bins + 1)</tt> must stay
+/// small.
+template<unsigned int Dimensions, unsigned int Bins>
+struct grid_importance_sampling
+{
+    /// The edges of the bins of each dimension, from 0 to 1.
+    float edges[Dimensions][Bins + 1];
+
+    __host__ __device__ float operator()(const integration_box<Dimensions>& box,
+                                         float (&point)[Dimensions]) const
+    {
+        float weight = 1.f;
+        for(unsigned int d = 0; d < Dimensions; ++d)
+        {
+            const float        scaled    = point[d] * Bins;
+            const unsigned int bin       = min(static_cast<unsigned int>(scaled), Bins - 1);
+            const float        bin_width = edges[d][bin + 1] - edges[d][bin];
+            const float        width     = box.upper[d] - box.lower[d];
+            point[d] = box.lower[d] + (edges[d][bin] + (scaled - bin) * bin_width) * width;
+            weight *= Bins * bin_width * width;
+        }
+        return weight;
+    }
+};
+
+/// \brief Returns the importance sampling grid of which every dimension follows the density
+/// <tt>density(d, t)</tt> for \p t in <tt>[0, 1]</tt>, up to a constant factor. The density must be
+/// positive wherever the integrand is not zero.
+template<unsigned int Dimensions, unsigned int Bins, typename Density>
+grid_importance_sampling<Dimensions, Bins> make_importance_grid(Density density)
+{
+    // The cumulative distribution of each dimension is integrated numerically over a fine grid,
+    // and inverted at the multiples of 1 / Bins.
+    constexpr unsigned int steps = 64 * Bins;
+
+    grid_importance_sampling<Dimensions, Bins> grid;
+    for(unsigned int d = 0; d < Dimensions; ++d)
+    {
+        std::vector<double> cumulative(steps + 1, 0.0);
+        for(unsigned int i = 0; i < steps; ++i)
+        {
+            cumulative[i + 1] = cumulative[i] + density(d, (i + 0.5) / steps);
+        }
+
+        grid.edges[d][0]    = 0.f;
+        grid.edges[d][Bins] = 1.f;
+        unsigned int step   = 0;
+        for(unsigned int bin = 1; bin < Bins; ++bin)
+        {
+            const double mass = cumulative[steps] * bin / Bins;
+            while(cumulative[step + 1] < mass)
+            {
+                ++step;
+            }
+            const double fraction
+                = (mass - cumulative[step]) / (cumulative[step + 1] - cumulative[step]);
+            grid.edges[d][bin] = static_cast<float>((step + fraction) / steps);
+        }
+    }
+    return grid;
+}
+
+/// \brief Settings of a Monte Carlo integration.
+struct monte_carlo_settings
+{
+    /// The generator of the points. Quasirandom generators are set to the dimension of the
+    /// integrands.
+    hiprandRngType_t rng_type = HIPRAND_RNG_QUASI_SOBOL32;
+    /// Seed of pseudorandom generators.
+    unsigned long long seed = 42;
+    /// Number of samples of each integrand.
+    unsigned long long sample_count = 1 << 20;
+    /// Number of points generated at once. The memory used is proportional to the number of
+    /// dimensions times the chunk size, whatever the number of samples.
+    unsigned int chunk_size = 1 << 18;
+    /// If greater than 1, every dimension is split into this many strata, and the samples are
+    /// distributed evenly over the cells of the resulting grid. Requires a pseudorandom generator.
+    unsigned int strata_per_dimension = 1;
+};
+
+/// \brief Approximation of an integral and its standard error.
+struct monte_carlo_estimate
+{
+    double value;
+    double standard_error;
+};
+
+/// \brief Returns the number of strata of the stratified sampling of \p Dimensions dimensions with
+/// \p strata_per_dimension strata per dimension.
+template<unsigned int Dimensions>
+unsigned long long monte_carlo_strata_count(const unsigned int strata_per_dimension)
+{
+    unsigned long long strata_count = 1;
+    for(unsigned int d = 0; d < Dimensions; ++d)
+    {
+        strata_count *= strata_per_dimension;
+    }
+    return strata_count;
+}
+
+/// \brief Moves the point of the unit cube \p point into the stratum of the sample \p index, when
+/// every dimension is split into \p strata_per_dimension strata. Consecutive samples are in
+/// different strata, so every stratum gets the same number of samples.
+template<unsigned int Dimensions>
+__device__ void stratify(unsigned long long       index,
+                         const unsigned int       strata_per_dimension,
+                         float (&point)[Dimensions])
+{
+    for(unsigned int d = 0; d < Dimensions; ++d)
+    {
+        const unsigned int cell = index % strata_per_dimension;
+        index /= strata_per_dimension;
+        point[d] = (cell + point[d]) / strata_per_dimension;
+    }
+}
+
+/// \brief Evaluates the integrand \p blockIdx.y of \p integrand on the \p point_count points of
+/// the unit cube \p d_points, which stores the first dimension of all points followed by the
+/// second dimension and so on. The points are stratified, if \p strata_per_dimension is greater
+/// than 1, and mapped to the box of the integrand by \p sampling. The sums of the weighted values
+/// of the integrand and of their squares are added to <tt>d_sums[2 * integrand]</tt> and
+/// <tt>d_sums[2 * integrand + 1]</tt>.
+template<unsigned int Dimensions,
+         unsigned int BlockSize,
+         typename Integrand,
+         typename Sampling>
+__global__ __launch_bounds__(BlockSize) void monte_carlo_integrate_chunk(
+    const float* __restrict__                  d_points,
+    const unsigned int                         point_count,
+    const unsigned long long                   first_point,
+    const unsigned int                         strata_per_dimension,
+    const integration_box<Dimensions>* __restrict__ d_boxes,
+    const Integrand                            integrand,
+    const Sampling                             sampling,
+    double*                                    d_sums)
+{
+    using block_reduce = hipcub::BlockReduce<double, BlockSize>;
+    __shared__ typename block_reduce::TempStorage temp_storage;
+
+    const unsigned int                integrand_index = blockIdx.y;
+    const integration_box<Dimensions> box             = d_boxes[integrand_index];
+
+    double sum         = 0.0;
+    double squared_sum = 0.0;
+    for(unsigned int i = blockIdx.x * BlockSize + threadIdx.x; i < point_count;
+        i += gridDim.x * BlockSize)
+    {
+        float point[Dimensions];
+        for(unsigned int d = 0; d < Dimensions; ++d)
+        {
+            point[d] = d_points[d * point_count + i];
+        }
+        if(strata_per_dimension > 1)
+        {
+            stratify(first_point + i, strata_per_dimension, point);
+        }
+
+        const float  weight = sampling(box, point);
+        const double value  = static_cast<double>(weight) * integrand(integrand_index, point);
+        sum += value;
+        squared_sum += value * value;
+    }
+
+    const double block_sum = block_reduce(temp_storage).Sum(sum);
+    __syncthreads();
+    const double block_squared_sum = block_reduce(temp_storage).Sum(squared_sum);
+    if(threadIdx.x == 0)
+    {
+        atomicAdd(&d_sums[2 * integrand_index], block_sum);
+        atomicAdd(&d_sums[2 * integrand_index + 1], block_squared_sum);
+    }
+}
+
+/// \brief Integrates the batch of integrands \p integrand over their \p boxes with the Monte Carlo
+/// method, and returns the approximation of each integral. \p integrand is a device functor
+/// called as <tt>integrand(i, point)</tt>, which returns the value of the integrand \p i at a
+/// point of <tt>float[Dimensions]</tt>. All integrands are evaluated at the same points, in the
+/// same launches. The points are generated in chunks by the hipRAND generator of \p settings,
+/// stratified if requested, and mapped to the boxes by \p sampling, which is
+/// \p uniform_sampling, \p grid_importance_sampling or another functor with the same interface.
+/// The standard errors assume independent samples, so they overestimate the error of
+/// quasirandom and stratified samples.
+template<unsigned int Dimensions,
+         typename Integrand,
+         typename Sampling = uniform_sampling<Dimensions>>
+std::vector<monte_carlo_estimate>
+    monte_carlo_integrate(const std::vector<integration_box<Dimensions>>& boxes,
+                          const Integrand                                 integrand,
+                          const monte_carlo_settings&                     settings,
+                          const Sampling                                  sampling = Sampling{})
+{
+    const unsigned int integrand_count = static_cast<unsigned int>(boxes.size());
+
+    // Every stratum gets the same number of samples.
+    const unsigned long long strata_count
+        = monte_carlo_strata_count<Dimensions>(settings.strata_per_dimension);
+    const unsigned long long sample_count
+        = ceiling_div(settings.sample_count, strata_count) * strata_count;
+
+    const bool quasi = settings.rng_type == HIPRAND_RNG_QUASI_DEFAULT
+                       || settings.rng_type == HIPRAND_RNG_QUASI_SOBOL32
+                       || settings.rng_type == HIPRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+                       || settings.rng_type == HIPRAND_RNG_QUASI_SOBOL64
+                       || settings.rng_type == HIPRAND_RNG_QUASI_SCRAMBLED_SOBOL64;
+    // The stratum of a sample is chosen from its index. The points of a quasirandom sequence
+    // depend on their index as well, so the points of a stratum would not be uniform in the unit
+    // cube, which biases the estimate.
+    if(quasi && settings.strata_per_dimension > 1)
+    {
+        std::cerr << "Stratified sampling requires a pseudorandom generator." << std::endl;
+        std::exit(error_exit_code);
+    }
+
+    hiprandGenerator_t generator;
+    HIPRAND_CHECK(hiprandCreateGenerator(&generator, settings.rng_type));
+    if(quasi)
+    {
+        HIPRAND_CHECK(hiprandSetQuasiRandomGeneratorDimensions(generator, Dimensions));
+    }
+    else
+    {
+        HIPRAND_CHECK(hiprandSetPseudoRandomGeneratorSeed(generator, settings.seed));
+    }
+
+    const unsigned int chunk_size = static_cast<unsigned int>(
+        std::min<unsigned long long>(settings.chunk_size, sample_count));
+
+    float*                       d_points{};
+    integration_box<Dimensions>* d_boxes{};
+    double*                      d_sums{};
+    HIP_CHECK(hipMalloc(&d_points, sizeof(float) * Dimensions * chunk_size));
+    HIP_CHECK(hipMalloc(&d_boxes, sizeof(integration_box<Dimensions>) * integrand_count));
+    HIP_CHECK(hipMalloc(&d_sums, sizeof(double) * 2 * integrand_count));
+    HIP_CHECK(hipMemcpy(d_boxes,
+                        boxes.data(),
+                        sizeof(integration_box<Dimensions>) * integrand_count,
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemset(d_sums, 0, sizeof(double) * 2 * integrand_count));
+
+    for(unsigned long long first_point = 0; first_point < sample_count; first_point += chunk_size)
+    {
+        const unsigned int point_count
+            = static_cast<unsigned int>(std::min<unsigned long long>(chunk_size,
+                                                                     sample_count - first_point));
+
+        // The chunks are consecutive ranges of the same sequence. The offset of a pseudorandom
+        // generator counts random numbers, the offset of a quasirandom generator counts points in
+        // each dimension.
+        HIPRAND_CHECK(
+            hiprandSetGeneratorOffset(generator,
+                                      quasi ? first_point : first_point * Dimensions));
+        HIPRAND_CHECK(hiprandGenerateUniform(generator, d_points, Dimensions * point_count));
+
+        const dim3 grid_dim(std::min(ceiling_div(point_count, monte_carlo_block_size),
+                                     monte_carlo_max_blocks),
+                            integrand_count);
+        monte_carlo_integrate_chunk<Dimensions, monte_carlo_block_size>
+            <<<grid_dim, monte_carlo_block_size>>>(d_points,
+                                                   point_count,
+                                                   first_point,
+                                                   settings.strata_per_dimension,
+                                                   d_boxes,
+                                                   integrand,
+                                                   sampling,
+                                                   d_sums);
+        HIP_CHECK(hipGetLastError());
+    }
+
+    std::vector<double> sums(2 * integrand_count);
+    HIP_CHECK(
+        hipMemcpy(sums.data(), d_sums, sizeof(double) * sums.size(), hipMemcpyDeviceToHost));
+
+    HIP_CHECK(hipFree(d_sums));
+    HIP_CHECK(hipFree(d_boxes));
+    HIP_CHECK(hipFree(d_points));
+    HIPRAND_CHECK(hiprandDestroyGenerator(generator));
+
+    std::vector<monte_carlo_estimate> estimates(integrand_count);
+    for(unsigned int i = 0; i < integrand_count; ++i)
+    {
+        const double mean     = sums[2 * i] / sample_count;
+        const double variance = std::max(sums[2 * i + 1] / sample_count - mean * mean, 0.0);
+        estimates[i]          = {mean, std::sqrt(variance / sample_count)};
+    }
+    return estimates;
+}
+
+#endif // APPLICATIONS_MONTE_CARLO_PI_MONTE_CARLO_HPP
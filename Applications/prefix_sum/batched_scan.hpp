@@ -0,0 +1,326 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef APPLICATIONS_PREFIX_SUM_BATCHED_SCAN_HPP
+#define APPLICATIONS_PREFIX_SUM_BATCHED_SCAN_HPP
+
+#include "example_utils.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+#include <stdexcept>
+
+/// \brief Number of threads in each block of the batched scan.
+constexpr unsigned int batched_scan_block_size = 256;
+
+/// \brief Arrays of at most this many times the warp size items are scanned by a single warp of
+/// the batched scan, and longer arrays by a whole block.
+constexpr unsigned int batched_scan_warp_chunks = 16;
+
+/// \brief Computes the inclusive prefix sum of \p value over the lanes of a warp of \p WarpSize
+/// threads with shuffles.
+template<unsigned int WarpSize, typename T>
+__device__ __forceinline__ T warp_inclusive_sum(T value, const unsigned int lane)
+{
+    for(unsigned int offset = 1; offset < WarpSize; offset <<= 1)
+    {
+        const T other = __shfl_up(value, offset, WarpSize);
+        if(lane >= offset)
+        {
+            value += other;
+        }
+    }
+    return value;
+}
+
+/// \brief Writes the prefix sum of the item of \p lane, whose inclusive prefix sum is
+/// \p inclusive, to \p d_output. The exclusive prefix sum of an item is the inclusive prefix sum
+/// of the item before it, or \p carry for the first lane, so it is exact whatever the type.
+template<unsigned int WarpSize, bool Exclusive, typename T>
+__device__ __forceinline__ void store_batched_prefix_sum(T*                 d_output,
+                                                         const size_t       index,
+                                                         const size_t       end,
+                                                         const T            inclusive,
+                                                         const T            carry,
+                                                         const unsigned int lane)
+{
+    T result = inclusive;
+    if(Exclusive)
+    {
+        result = __shfl_up(inclusive, 1, WarpSize);
+        if(lane == 0)
+        {
+            result = carry;
+        }
+    }
+    if(index < end)
+    {
+        d_output[index] = result;
+    }
+}
+
+/// \brief Scans the items <tt>[begin, end)</tt> with a single warp, one item per lane at a time.
+template<unsigned int WarpSize, bool Exclusive, typename T>
+__device__ void warp_scan_array(const T*           d_input,
+                                T*                 d_output,
+                                const size_t       begin,
+                                const size_t       end,
+                                const unsigned int lane)
+{
+    T carry = T{};
+    for(size_t base = begin; base < end; base += WarpSize)
+    {
+        const size_t index     = base + lane;
+        const T      item      = index < end ? d_input[index] : T{};
+        const T      inclusive = carry + warp_inclusive_sum<WarpSize>(item, lane);
+        store_batched_prefix_sum<WarpSize, Exclusive>(d_output, index, end, inclusive, carry, lane);
+        carry = __shfl(inclusive, WarpSize - 1, WarpSize);
+    }
+}
+
+/// \brief Scans the items <tt>[begin, end)</tt> with the whole block, one item per thread at a
+/// time. The sums of the warps are scanned by the first warp through \p warp_sums.
+template<unsigned int BlockSize, unsigned int WarpSize, bool Exclusive, typename T>
+__device__ void block_scan_array(const T*     d_input,
+                                 T*           d_output,
+                                 const size_t begin,
+                                 const size_t end,
+                                 T*           warp_sums)
+{
+    constexpr unsigned int warp_count = BlockSize / WarpSize;
+    const unsigned int     lane       = threadIdx.x % WarpSize;
+    const unsigned int     warp_id    = threadIdx.x / WarpSize;
+
+    T carry = T{};
+    for(size_t base = begin; base < end; base += BlockSize)
+    {
+        const size_t index     = base + threadIdx.x;
+        const T      item      = index < end ? d_input[index] : T{};
+        T            inclusive = warp_inclusive_sum<WarpSize>(item, lane);
+        if(lane == WarpSize - 1)
+        {
+            warp_sums[warp_id] = inclusive;
+        }
+        __syncthreads();
+
+        if(warp_id == 0)
+        {
+            const T warp_sum = lane < warp_count ? warp_sums[lane] : T{};
+            const T warp_prefix_sum = warp_inclusive_sum<WarpSize>(warp_sum, lane);
+            if(lane < warp_count)
+            {
+                warp_sums[lane] = warp_prefix_sum;
+            }
+        }
+        __syncthreads();
+
+        const T warp_prefix = warp_id > 0 ? carry + warp_sums[warp_id - 1] : carry;
+        inclusive           = warp_prefix + inclusive;
+        store_batched_prefix_sum<WarpSize, Exclusive>(d_output,
+                                                      index,
+                                                      end,
+                                                      inclusive,
+                                                      warp_prefix,
+                                                      lane);
+        carry = carry + warp_sums[warp_count - 1];
+        // The sums of the warps are overwritten by the next items.
+        __syncthreads();
+    }
+}
+
+/// \brief Computes the prefix sum of every array of a batch in place of \p d_output, which may be
+/// \p d_input. The array \p i holds the items <tt>[d_offsets[i], d_offsets[i + 1])</tt>.
+///
+/// Every block takes one array per warp. Every warp first scans its array alone, unless it holds
+/// more than <tt>batched_scan_warp_chunks * WarpSize</tt> items. Then the whole block scans the
+/// long arrays of its warps, one after the other. So the many short arrays are scanned without
+/// synchronizing the block, and the few long arrays with all the threads of a block.
+template<unsigned int BlockSize, unsigned int WarpSize, bool Exclusive, typename T>
+__global__ __launch_bounds__(BlockSize) void
+    batched_prefix_sum_kernel(const T*      d_input,
+                              T*            d_output,
+                              const size_t* d_offsets,
+                              const size_t  array_count)
+{
+    constexpr unsigned int warp_count = BlockSize / WarpSize;
+    constexpr size_t       warp_limit = batched_scan_warp_chunks * WarpSize;
+    static_assert(warp_count <= WarpSize, "The sums of the warps must fit in a warp.");
+
+    __shared__ T warp_sums[warp_count];
+
+    const unsigned int lane        = threadIdx.x % WarpSize;
+    const unsigned int warp_id     = threadIdx.x / WarpSize;
+    const size_t       first_array = static_cast<size_t>(blockIdx.x) * warp_count;
+
+    const size_t array = first_array + warp_id;
+    if(array < array_count)
+    {
+        const size_t begin = d_offsets[array];
+        const size_t end   = d_offsets[array + 1];
+        if(end - begin <= warp_limit)
+        {
+            warp_scan_array<WarpSize, Exclusive>(d_input, d_output, begin, end, lane);
+        }
+    }
+
+    for(unsigned int i = 0; i < warp_count && first_array + i < array_count; ++i)
+    {
+        const size_t begin = d_offsets[first_array + i];
+        const size_t end   = d_offsets[first_array + i + 1];
+        if(end - begin > warp_limit)
+        {
+            block_scan_array<BlockSize, WarpSize, Exclusive>(d_input,
+                                                             d_output,
+                                                             begin,
+                                                             end,
+                                                             warp_sums);
+        }
+    }
+}
+
+/// \brief Computes the prefix sum of each of the \p array_count arrays of \p d_input into
+/// \p d_output, which may be the same, with a single launch on \p stream. The array \p i holds the
+/// items <tt>[d_offsets[i], d_offsets[i + 1])</tt>, so \p d_offsets holds
+/// <tt>array_count + 1</tt> offsets. \p warp_size is the number of threads of a warp of the
+/// device.
+template<bool Exclusive, typename T>
+void batched_prefix_sum(const T*           d_input,
+                        T*                 d_output,
+                        const size_t*      d_offsets,
+                        const size_t       array_count,
+                        const unsigned int warp_size,
+                        hipStream_t        stream = hipStreamDefault)
+{
+    if(array_count == 0)
+    {
+        return;
+    }
+
+    const size_t grid_size = ceiling_div(array_count, batched_scan_block_size / warp_size);
+    if(warp_size == 32)
+    {
+        batched_prefix_sum_kernel<batched_scan_block_size, 32, Exclusive>
+            <<<static_cast<unsigned int>(grid_size), batched_scan_block_size, 0, stream>>>(
+                d_input,
+                d_output,
+                d_offsets,
+                array_count);
+    }
+    else if(warp_size == 64)
+    {
+        batched_prefix_sum_kernel<batched_scan_block_size, 64, Exclusive>
+            <<<static_cast<unsigned int>(grid_size), batched_scan_block_size, 0, stream>>>(
+                d_input,
+                d_output,
+                d_offsets,
+                array_count);
+    }
+    else
+    {
+        throw std::runtime_error("Unsupported warp size");
+    }
+    HIP_CHECK(hipGetLastError());
+}
+
+/// \brief Device buffers of the batched prefix sums of arrays on the host. They only grow, so
+/// once they hold the largest batch, the following batches are scanned without allocating.
+template<typename T>
+struct batched_scan_workspace
+{
+    T*      d_items         = nullptr;
+    size_t* d_offsets       = nullptr;
+    size_t  item_capacity   = 0;
+    size_t  offset_capacity = 0;
+};
+
+/// \brief Makes the buffers of \p workspace hold at least \p item_count items and
+/// \p offset_count offsets, reallocating the ones that are too small.
+template<typename T>
+void reserve_batched_scan_workspace(batched_scan_workspace<T>& workspace,
+                                    const size_t               item_count,
+                                    const size_t               offset_count)
+{
+    if(item_count > workspace.item_capacity)
+    {
+        HIP_CHECK(hipFree(workspace.d_items));
+        HIP_CHECK(hipMalloc(&workspace.d_items, sizeof(T) * item_count));
+        workspace.item_capacity = item_count;
+    }
+    if(offset_count > workspace.offset_capacity)
+    {
+        HIP_CHECK(hipFree(workspace.d_offsets));
+        HIP_CHECK(hipMalloc(&workspace.d_offsets, sizeof(size_t) * offset_count));
+        workspace.offset_capacity = offset_count;
+    }
+}
+
+/// \brief Frees the buffers of \p workspace.
+template<typename T>
+void free_batched_scan_workspace(batched_scan_workspace<T>& workspace)
+{
+    HIP_CHECK(hipFree(workspace.d_offsets));
+    HIP_CHECK(hipFree(workspace.d_items));
+    workspace = batched_scan_workspace<T>{};
+}
+
+/// \brief Computes the prefix sum of each of the \p array_count arrays packed in \p input into
+/// \p output, both on the host, with the buffers of \p workspace. The array \p i holds the items
+/// <tt>[offsets[i], offsets[i + 1])</tt>. The items and the offsets are copied to the device, all
+/// arrays are scanned with a single launch, and the results are copied back, on \p stream.
+template<bool Exclusive, typename T>
+void batched_prefix_sum(batched_scan_workspace<T>& workspace,
+                        const T*                   input,
+                        const size_t*              offsets,
+                        const size_t               array_count,
+                        T*                         output,
+                        const unsigned int         warp_size,
+                        hipStream_t                stream = hipStreamDefault)
+{
+    const size_t item_count = offsets[array_count];
+    reserve_batched_scan_workspace(workspace, item_count, array_count + 1);
+
+    HIP_CHECK(hipMemcpyAsync(workspace.d_items,
+                             input,
+                             sizeof(T) * item_count,
+                             hipMemcpyHostToDevice,
+                             stream));
+    HIP_CHECK(hipMemcpyAsync(workspace.d_offsets,
+                             offsets,
+                             sizeof(size_t) * (array_count + 1),
+                             hipMemcpyHostToDevice,
+                             stream));
+    batched_prefix_sum<Exclusive>(workspace.d_items,
+                                  workspace.d_items,
+                                  workspace.d_offsets,
+                                  array_count,
+                                  warp_size,
+                                  stream);
+    HIP_CHECK(hipMemcpyAsync(output,
+                             workspace.d_items,
+                             sizeof(T) * item_count,
+                             hipMemcpyDeviceToHost,
+                             stream));
+    HIP_CHECK(hipStreamSynchronize(stream));
+}
+
+#endif // APPLICATIONS_PREFIX_SUM_BATCHED_SCAN_HPP
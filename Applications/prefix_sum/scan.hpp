@@ -0,0 +1,567 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef APPLICATIONS_PREFIX_SUM_SCAN_HPP
+#define APPLICATIONS_PREFIX_SUM_SCAN_HPP
+
+#include "example_utils.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+
+/// \brief Number of threads in each block of the single-pass scan.
+constexpr unsigned int scan_block_size = 256;
+
+/// \brief Number of consecutive items of type \p T scanned by each thread of the single-pass scan.
+/// Types larger than 8 bytes are scanned 4 items at a time, so a tile fits in shared memory.
+template<typename T>
+constexpr unsigned int scan_items_per_thread = sizeof(T) <= 8 ? 8 : 4;
+
+/// \brief Number of items of type \p T of each tile of the single-pass scan.
+template<typename T>
+constexpr unsigned int scan_tile_size = scan_block_size * scan_items_per_thread<T>;
+
+/// \brief Adds two values. The operator of prefix sums.
+struct scan_sum
+{
+    template<typename T>
+    __host__ __device__ T operator()(const T& lhs, const T& rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+/// \brief Status of a tile of the single-pass scan, as seen by the tiles after it.
+enum scan_tile_flag : unsigned int
+{
+    /// The tile has not published anything yet.
+    scan_tile_invalid = 0,
+    /// The reduction of the items of the tile is available.
+    scan_tile_aggregate = 1,
+    /// The reduction of the items of the tile and all tiles before it is available.
+    scan_tile_inclusive = 2
+};
+
+/// \brief The status of every tile of a single-pass scan of items of type \p T, and the counter
+/// that numbers the tiles in the order the blocks start.
+template<typename T>
+struct scan_tile_status
+{
+    unsigned int* counter;
+    unsigned int* flags;
+    T*            aggregates;
+    T*            inclusive_prefixes;
+};
+
+/// \brief Returns the index of the item \p i of a tile in shared memory. A padding item is inserted
+/// every 32 items, so the threads that scan consecutive items access different banks.
+__host__ __device__ constexpr unsigned int scan_shared_index(const unsigned int i)
+{
+    return i + i / 32;
+}
+
+/// \brief Reads the value at \p address, which is written by another block, with a volatile load of
+/// each of its words. Unlike plain loads, these are not served from the caches that are not
+/// coherent between the compute units.
+template<typename T>
+__device__ __forceinline__ T scan_load_coherent(const T* address)
+{
+    static_assert(sizeof(T) % sizeof(unsigned int) == 0,
+                  "The size of the scanned type must be a multiple of 4 bytes.");
+    constexpr unsigned int word_count = sizeof(T) / sizeof(unsigned int);
+
+    const volatile unsigned int* source = reinterpret_cast<const volatile unsigned int*>(address);
+    unsigned int                 words[word_count];
+    for(unsigned int i = 0; i < word_count; ++i)
+    {
+        words[i] = source[i];
+    }
+    T value;
+    __builtin_memcpy(&value, words, sizeof(T));
+    return value;
+}
+
+/// \brief Publishes the \p value of \p tile with \p flag. The value is written before the flag, so
+/// a tile that reads the flag also reads the value.
+template<typename T>
+__device__ __forceinline__ void publish_tile_status(const scan_tile_status<T> status,
+                                                    const unsigned int        tile,
+                                                    const scan_tile_flag      flag,
+                                                    const T&                  value)
+{
+    (flag == scan_tile_inclusive ? status.inclusive_prefixes : status.aggregates)[tile] = value;
+    __threadfence();
+    atomicExch(&status.flags[tile], static_cast<unsigned int>(flag));
+}
+
+/// \brief Waits until \p tile has published at least its aggregate, and returns its flag.
+template<typename T>
+__device__ __forceinline__ unsigned int wait_for_tile_status(const scan_tile_status<T> status,
+                                                             const unsigned int        tile)
+{
+    const volatile unsigned int* flags = status.flags;
+
+    unsigned int flag;
+    while((flag = flags[tile]) == scan_tile_invalid) {}
+    __threadfence();
+    return flag;
+}
+
+/// \brief Computes the reduction with \p op of the items before \p tile with a decoupled look-back:
+/// walks back over the preceding tiles, waiting until each has published at least its aggregate,
+/// and combines the aggregates until a tile that has published its inclusive prefix is found.
+/// The value of every preceding tile is combined on the left, so the operands stay in the order of
+/// the items.
+template<typename T, typename ScanOp>
+__device__ T
+    scan_look_back(const scan_tile_status<T> status, const unsigned int tile, const ScanOp op)
+{
+    unsigned int predecessor = tile - 1;
+    if(wait_for_tile_status(status, predecessor) == scan_tile_inclusive)
+    {
+        return scan_load_coherent(&status.inclusive_prefixes[predecessor]);
+    }
+
+    T exclusive_prefix = scan_load_coherent(&status.aggregates[predecessor]);
+    for(--predecessor;; --predecessor)
+    {
+        if(wait_for_tile_status(status, predecessor) == scan_tile_inclusive)
+        {
+            return op(scan_load_coherent(&status.inclusive_prefixes[predecessor]),
+                      exclusive_prefix);
+        }
+        exclusive_prefix
+            = op(scan_load_coherent(&status.aggregates[predecessor]), exclusive_prefix);
+    }
+}
+
+/// \brief Loads the items of a scan from an array.
+template<typename T>
+struct scan_array_load
+{
+    const T* data;
+
+    __device__ T operator()(const size_t index) const
+    {
+        return data[index];
+    }
+};
+
+/// \brief Stores the results of a scan to an array.
+template<typename T>
+struct scan_array_store
+{
+    T* data;
+
+    __device__ void operator()(const size_t index, const T& result) const
+    {
+        data[index] = result;
+    }
+};
+
+/// \brief Scans \p size items with the associative operator \p op in a single pass, reading and
+/// writing every item once. The item \p index is read with <tt>load(index)</tt> and its result is
+/// written with <tt>store(index, result)</tt>. An inclusive scan computes
+/// <tt>x[0] op ... op x[index]</tt>, and an \p Exclusive scan
+/// <tt>init op x[0] op ... op x[index - 1]</tt>, which is \p init for the first item.
+///
+/// Every block scans a tile of <tt>BlockSize * ItemsPerThread</tt> items, publishes the reduction
+/// of the tile, and obtains the reduction of the items before the tile from the tiles before it
+/// with a decoupled look-back. \p op is only ever applied to items of the input, \p init and their
+/// reductions, with the operands in the order of the items. So it needs neither an identity nor to
+/// be commutative.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         bool         Exclusive,
+         typename T,
+         typename Load,
+         typename Store,
+         typename ScanOp>
+__global__ __launch_bounds__(BlockSize) void
+    single_pass_scan_kernel(const Load                load,
+                            const Store               store,
+                            const size_t              size,
+                            const ScanOp              op,
+                            const T                   init,
+                            const scan_tile_status<T> status)
+{
+    constexpr unsigned int tile_size = BlockSize * ItemsPerThread;
+
+    __shared__ T            items[scan_shared_index(tile_size)];
+    __shared__ T            thread_sums[BlockSize];
+    __shared__ unsigned int tile_index;
+    __shared__ T            tile_exclusive_prefix;
+
+    const unsigned int thread_id = threadIdx.x;
+
+    // The tiles are numbered in the order the blocks start, rather than by block index, so the
+    // tiles a block waits for during the look-back are always processed by running blocks.
+    if(thread_id == 0)
+    {
+        tile_index = atomicAdd(status.counter, 1);
+    }
+    __syncthreads();
+    const unsigned int tile       = tile_index;
+    const size_t       tile_begin = static_cast<size_t>(tile) * tile_size;
+    const unsigned int valid_items
+        = size - tile_begin < tile_size ? static_cast<unsigned int>(size - tile_begin) : tile_size;
+    const unsigned int valid_threads = ceiling_div(valid_items, ItemsPerThread);
+
+    // Load the tile with consecutive threads reading consecutive items.
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int item = i * BlockSize + thread_id;
+        if(item < valid_items)
+        {
+            items[scan_shared_index(item)] = load(tile_begin + item);
+        }
+    }
+    __syncthreads();
+
+    // Every thread scans its own consecutive items.
+    const unsigned int first_item   = thread_id * ItemsPerThread;
+    const unsigned int thread_items = thread_id < valid_threads
+                                          ? min(ItemsPerThread, valid_items - first_item)
+                                          : 0;
+    if(thread_items > 0)
+    {
+        T thread_sum = items[scan_shared_index(first_item)];
+        for(unsigned int i = 1; i < ItemsPerThread; ++i)
+        {
+            if(i < thread_items)
+            {
+                const unsigned int item = scan_shared_index(first_item + i);
+                thread_sum              = op(thread_sum, items[item]);
+                items[item]             = thread_sum;
+            }
+        }
+        thread_sums[thread_id] = thread_sum;
+    }
+    __syncthreads();
+
+    // Inclusive scan of the sums of the threads that have items.
+    for(unsigned int offset = 1; offset < BlockSize; offset <<= 1)
+    {
+        const bool combine = thread_id >= offset && thread_id < valid_threads;
+        T          addend;
+        if(combine)
+        {
+            addend = thread_sums[thread_id - offset];
+        }
+        __syncthreads();
+        if(combine)
+        {
+            thread_sums[thread_id] = op(addend, thread_sums[thread_id]);
+        }
+        __syncthreads();
+    }
+
+    if(thread_id == 0)
+    {
+        const T tile_aggregate = thread_sums[valid_threads - 1];
+        if(tile == 0)
+        {
+            publish_tile_status(status,
+                                tile,
+                                scan_tile_inclusive,
+                                Exclusive ? op(init, tile_aggregate) : tile_aggregate);
+            tile_exclusive_prefix = init;
+        }
+        else
+        {
+            // Publish the aggregate first, so the tiles after this one can go on with their
+            // look-back while this one does its own.
+            publish_tile_status(status, tile, scan_tile_aggregate, tile_aggregate);
+            const T exclusive_prefix = scan_look_back(status, tile, op);
+            publish_tile_status(status,
+                                tile,
+                                scan_tile_inclusive,
+                                op(exclusive_prefix, tile_aggregate));
+            tile_exclusive_prefix = exclusive_prefix;
+        }
+    }
+    __syncthreads();
+
+    // Combine the reduction of the items before the thread with its items. Only the first thread
+    // of the first tile of an inclusive scan has no items before it.
+    const bool tile_has_prefix = Exclusive || tile > 0;
+    if(thread_items > 0 && (tile_has_prefix || thread_id > 0))
+    {
+        T thread_prefix = tile_exclusive_prefix;
+        if(thread_id > 0)
+        {
+            thread_prefix = tile_has_prefix
+                                ? op(tile_exclusive_prefix, thread_sums[thread_id - 1])
+                                : thread_sums[thread_id - 1];
+        }
+
+        if(Exclusive)
+        {
+            // Every item takes the result of the item before it.
+            for(unsigned int i = ItemsPerThread - 1; i > 0; --i)
+            {
+                if(i < thread_items)
+                {
+                    items[scan_shared_index(first_item + i)]
+                        = op(thread_prefix, items[scan_shared_index(first_item + i - 1)]);
+                }
+            }
+            items[scan_shared_index(first_item)] = thread_prefix;
+        }
+        else
+        {
+            for(unsigned int i = 0; i < ItemsPerThread; ++i)
+            {
+                if(i < thread_items)
+                {
+                    const unsigned int item = scan_shared_index(first_item + i);
+                    items[item]             = op(thread_prefix, items[item]);
+                }
+            }
+        }
+    }
+    __syncthreads();
+
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int item = i * BlockSize + thread_id;
+        if(item < valid_items)
+        {
+            store(tile_begin + item, items[scan_shared_index(item)]);
+        }
+    }
+}
+
+/// \brief Returns the number of tiles of the single-pass scan of \p size items of type \p T.
+template<typename T>
+size_t scan_tile_count(const size_t size)
+{
+    return ceiling_div(size, scan_tile_size<T>);
+}
+
+/// \brief Returns the offset in bytes of the values of the tile status in the temporary storage of
+/// a scan of \p tile_count tiles of items of type \p T. They follow the tile counter and the flags.
+template<typename T>
+size_t scan_values_offset(const size_t tile_count)
+{
+    return ceiling_div(sizeof(unsigned int) * (1 + tile_count), alignof(T)) * alignof(T);
+}
+
+/// \brief Returns the number of bytes of temporary storage required by a single-pass scan of
+/// \p size items of type \p T.
+template<typename T>
+size_t scan_storage_size(const size_t size)
+{
+    const size_t tile_count = scan_tile_count<T>(size);
+    return scan_values_offset<T>(tile_count) + 2 * sizeof(T) * tile_count;
+}
+
+/// \brief Runs \p single_pass_scan_kernel over \p size items on \p stream. \p d_storage must hold
+/// <tt>scan_storage_size<T>(size)</tt> bytes.
+template<bool Exclusive, typename T, typename Load, typename Store, typename ScanOp>
+void single_pass_scan(const Load   load,
+                      const Store  store,
+                      const size_t size,
+                      const ScanOp op,
+                      const T&     init,
+                      void*        d_storage,
+                      hipStream_t  stream)
+{
+    if(size == 0)
+    {
+        return;
+    }
+
+    const size_t        tile_count = scan_tile_count<T>(size);
+    scan_tile_status<T> status;
+    status.counter = static_cast<unsigned int*>(d_storage);
+    status.flags   = status.counter + 1;
+    status.aggregates
+        = reinterpret_cast<T*>(static_cast<char*>(d_storage) + scan_values_offset<T>(tile_count));
+    status.inclusive_prefixes = status.aggregates + tile_count;
+
+    // The tile counter and the flags must be cleared before every scan.
+    HIP_CHECK(hipMemsetAsync(d_storage, 0, sizeof(unsigned int) * (1 + tile_count), stream));
+
+    single_pass_scan_kernel<scan_block_size, scan_items_per_thread<T>, Exclusive>
+        <<<static_cast<unsigned int>(tile_count), scan_block_size, 0, stream>>>(load,
+                                                                                 store,
+                                                                                 size,
+                                                                                 op,
+                                                                                 init,
+                                                                                 status);
+    HIP_CHECK(hipGetLastError());
+}
+
+/// \brief Computes the inclusive scan with \p op of \p size items of \p d_input into \p d_output,
+/// which may be the same, on \p stream. \p d_storage must hold <tt>scan_storage_size<T>(size)</tt>
+/// bytes.
+template<typename T, typename ScanOp>
+void inclusive_scan(const T*     d_input,
+                    T*           d_output,
+                    const size_t size,
+                    const ScanOp op,
+                    void*        d_storage,
+                    hipStream_t  stream = hipStreamDefault)
+{
+    single_pass_scan<false>(scan_array_load<T>{d_input},
+                            scan_array_store<T>{d_output},
+                            size,
+                            op,
+                            T{},
+                            d_storage,
+                            stream);
+}
+
+/// \brief Computes the exclusive scan with \p op of \p size items of \p d_input into \p d_output,
+/// which may be the same, starting from \p init, on \p stream. \p d_storage must hold
+/// <tt>scan_storage_size<T>(size)</tt> bytes.
+template<typename T, typename ScanOp>
+void exclusive_scan(const T*     d_input,
+                    T*           d_output,
+                    const size_t size,
+                    const ScanOp op,
+                    const T&     init,
+                    void*        d_storage,
+                    hipStream_t  stream = hipStreamDefault)
+{
+    single_pass_scan<true>(scan_array_load<T>{d_input},
+                           scan_array_store<T>{d_output},
+                           size,
+                           op,
+                           init,
+                           d_storage,
+                           stream);
+}
+
+/// \brief An item of a segmented scan: a value, and whether it is the first of its segment.
+template<typename T>
+struct segmented_scan_value
+{
+    T            value;
+    unsigned int head;
+};
+
+/// \brief Turns the operator \p op into the operator of a segmented scan, which restarts from the
+/// value of every head. The result is associative if \p op is, and is not commutative.
+template<typename ScanOp>
+struct segmented_scan_op
+{
+    ScanOp op;
+
+    template<typename T>
+    __host__ __device__ segmented_scan_value<T>
+        operator()(const segmented_scan_value<T>& lhs, const segmented_scan_value<T>& rhs) const
+    {
+        return {rhs.head ? rhs.value : op(lhs.value, rhs.value), lhs.head | rhs.head};
+    }
+};
+
+/// \brief Loads the items of a segmented scan from an array of values and an array of head flags.
+/// The first item is always a head. The head of every segment of an \p Exclusive scan is combined
+/// with \p init, as the segments after the first do not start from it otherwise.
+template<bool Exclusive, typename T, typename ScanOp>
+struct segmented_scan_load
+{
+    const T*             values;
+    const unsigned char* head_flags;
+    ScanOp               op;
+    T                    init;
+
+    __device__ segmented_scan_value<T> operator()(const size_t index) const
+    {
+        const unsigned int head  = index == 0 || head_flags[index] != 0;
+        const T            value = values[index];
+        return {Exclusive && head ? op(init, value) : value, head};
+    }
+};
+
+/// \brief Stores the results of a segmented scan to an array. The result of every head of an
+/// \p Exclusive scan is \p init.
+template<bool Exclusive, typename T>
+struct segmented_scan_store
+{
+    T*                   values;
+    const unsigned char* head_flags;
+    T                    init;
+
+    __device__ void operator()(const size_t index, const segmented_scan_value<T>& result) const
+    {
+        values[index] = Exclusive && (index == 0 || head_flags[index] != 0) ? init : result.value;
+    }
+};
+
+/// \brief Returns the number of bytes of temporary storage required by a segmented scan of
+/// \p size items of type \p T.
+template<typename T>
+size_t segmented_scan_storage_size(const size_t size)
+{
+    return scan_storage_size<segmented_scan_value<T>>(size);
+}
+
+/// \brief Computes the inclusive scan with \p op of every segment of the \p size items of
+/// \p d_input into \p d_output, which may be the same, on \p stream. A segment starts at every item
+/// with a nonzero flag in \p d_head_flags, and at the first item. \p d_storage must hold
+/// <tt>segmented_scan_storage_size<T>(size)</tt> bytes.
+template<typename T, typename ScanOp>
+void segmented_inclusive_scan(const T*             d_input,
+                              const unsigned char* d_head_flags,
+                              T*                   d_output,
+                              const size_t         size,
+                              const ScanOp         op,
+                              void*                d_storage,
+                              hipStream_t          stream = hipStreamDefault)
+{
+    single_pass_scan<false>(segmented_scan_load<false, T, ScanOp>{d_input, d_head_flags, op, T{}},
+                            segmented_scan_store<false, T>{d_output, d_head_flags, T{}},
+                            size,
+                            segmented_scan_op<ScanOp>{op},
+                            segmented_scan_value<T>{},
+                            d_storage,
+                            stream);
+}
+
+/// \brief Computes the exclusive scan with \p op of every segment of the \p size items of
+/// \p d_input into \p d_output, which may be the same, every segment starting from \p init, on
+/// \p stream. A segment starts at every item with a nonzero flag in \p d_head_flags, and at the
+/// first item. \p d_storage must hold <tt>segmented_scan_storage_size<T>(size)</tt> bytes.
+template<typename T, typename ScanOp>
+void segmented_exclusive_scan(const T*             d_input,
+                              const unsigned char* d_head_flags,
+                              T*                   d_output,
+                              const size_t         size,
+                              const ScanOp         op,
+                              const T&             init,
+                              void*                d_storage,
+                              hipStream_t          stream = hipStreamDefault)
+{
+    single_pass_scan<true>(segmented_scan_load<true, T, ScanOp>{d_input, d_head_flags, op, init},
+                           segmented_scan_store<true, T>{d_output, d_head_flags, init},
+                           size,
+                           segmented_scan_op<ScanOp>{op},
+                           segmented_scan_value<T>{init, 0},
+                           d_storage,
+                           stream);
+}
+
+#endif // APPLICATIONS_PREFIX_SUM_SCAN_HPP
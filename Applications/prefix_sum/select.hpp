@@ -0,0 +1,435 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef APPLICATIONS_PREFIX_SUM_SELECT_HPP
+#define APPLICATIONS_PREFIX_SUM_SELECT_HPP
+
+#include "example_utils.hpp"
+#include "scan.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+
+/// \brief The items of an array, as read and written by the selection primitives.
+template<typename T>
+struct array_view
+{
+    T* data;
+
+    __device__ T operator[](const size_t index) const
+    {
+        return data[index];
+    }
+
+    __device__ void store(const size_t index, const T& value) const
+    {
+        data[index] = value;
+    }
+};
+
+/// \brief An item of a pair of arrays.
+template<typename A, typename B>
+struct zip_value
+{
+    A first;
+    B second;
+
+    __host__ __device__ bool operator==(const zip_value& other) const
+    {
+        return first == other.first && second == other.second;
+    }
+};
+
+/// \brief The items of a pair of arrays of the same size, stored as a structure of arrays, as read
+/// and written by the selection primitives. Every item is read from and written to both arrays.
+template<typename A, typename B>
+struct zip_view
+{
+    A* first;
+    B* second;
+
+    __device__ zip_value<A, B> operator[](const size_t index) const
+    {
+        return {first[index], second[index]};
+    }
+
+    __device__ void store(const size_t index, const zip_value<A, B>& value) const
+    {
+        first[index]  = value.first;
+        second[index] = value.second;
+    }
+};
+
+/// \brief Compares two items with <tt>==</tt>. The default equality of \p unique.
+struct select_equal_to
+{
+    template<typename T>
+    __device__ bool operator()(const T& lhs, const T& rhs) const
+    {
+        return lhs == rhs;
+    }
+};
+
+/// \brief The highest bit of a selection count, which flags whether the item is selected. The
+/// other bits hold the number of selected items up to the item, included.
+constexpr unsigned long long selection_flag = 1ull << 63;
+
+/// \brief Scan operator of the selection counts: adds the counts, and keeps the flag of the item on
+/// the right. So the inclusive scan of the flags of the items gives the number of selected items up
+/// to every item, together with the flag of that item, without reading it again. The operator is
+/// associative but not commutative.
+struct selection_count_op
+{
+    __host__ __device__ unsigned long long operator()(const unsigned long long lhs,
+                                                      const unsigned long long rhs) const
+    {
+        return ((lhs & ~selection_flag) + (rhs & ~selection_flag)) | (rhs & selection_flag);
+    }
+};
+
+/// \brief Evaluates the predicate of \p select_if and \p partition on every item.
+template<typename Input, typename Predicate>
+struct select_if_load
+{
+    Input     input;
+    Predicate predicate;
+
+    __device__ unsigned long long operator()(const size_t index) const
+    {
+        return predicate(input[index]) ? selection_flag | 1 : 0;
+    }
+};
+
+/// \brief Flags the first item of every run of equal items for \p unique.
+template<typename Input, typename EqualTo>
+struct unique_load
+{
+    Input   input;
+    EqualTo equal_to;
+
+    __device__ unsigned long long operator()(const size_t index) const
+    {
+        return index == 0 || !equal_to(input[index - 1], input[index]) ? selection_flag | 1 : 0;
+    }
+};
+
+/// \brief Writes every selected item to \p output at the number of selected items before it, and
+/// the number of selected items to \p d_selected_count with the last item. If \p Partition, every
+/// rejected item is written from the end of \p output, in reverse order.
+template<bool Partition, typename Input, typename Output>
+struct select_store
+{
+    Input               input;
+    Output              output;
+    size_t              size;
+    unsigned long long* d_selected_count;
+
+    __device__ void operator()(const size_t index, const unsigned long long selection) const
+    {
+        const unsigned long long selected_count = selection & ~selection_flag;
+        if(selection & selection_flag)
+        {
+            output.store(selected_count - 1, input[index]);
+        }
+        else if(Partition)
+        {
+            const size_t rejected_count = index + 1 - selected_count;
+            output.store(size - rejected_count, input[index]);
+        }
+
+        if(index == size - 1)
+        {
+            *d_selected_count = selected_count;
+        }
+    }
+};
+
+/// \brief Returns the number of bytes of temporary storage required by \p select_if,
+/// \p partition, \p stable_partition and \p unique for \p size items.
+inline size_t select_storage_size(const size_t size)
+{
+    return scan_storage_size<unsigned long long>(size);
+}
+
+/// \brief Scans the selection counts of \p size items obtained with \p load, and writes the items
+/// of \p input to \p output with \p select_store.
+template<bool Partition, typename Load, typename Input, typename Output>
+void select_items(const Load          load,
+                  const Input         input,
+                  const Output        output,
+                  const size_t        size,
+                  unsigned long long* d_selected_count,
+                  void*               d_storage,
+                  hipStream_t         stream)
+{
+    if(size == 0)
+    {
+        HIP_CHECK(hipMemsetAsync(d_selected_count, 0, sizeof(unsigned long long), stream));
+        return;
+    }
+    single_pass_scan<false>(load,
+                            select_store<Partition, Input, Output>{input,
+                                                                   output,
+                                                                   size,
+                                                                   d_selected_count},
+                            size,
+                            selection_count_op{},
+                            0ull,
+                            d_storage,
+                            stream);
+}
+
+/// \brief Copies the \p size items of \p input that satisfy \p predicate to \p output, in order, on
+/// \p stream, and writes their number to \p d_selected_count. The predicate is evaluated once per
+/// item, while the items are scanned. \p input and \p output are \p array_view or \p zip_view, and
+/// must not overlap. \p d_storage must hold <tt>select_storage_size(size)</tt> bytes.
+template<typename Input, typename Output, typename Predicate>
+void select_if(const Input         input,
+               const Output        output,
+               const size_t        size,
+               const Predicate     predicate,
+               unsigned long long* d_selected_count,
+               void*               d_storage,
+               hipStream_t         stream = hipStreamDefault)
+{
+    select_items<false>(select_if_load<Input, Predicate>{input, predicate},
+                        input,
+                        output,
+                        size,
+                        d_selected_count,
+                        d_storage,
+                        stream);
+}
+
+/// \brief Copies the first item of every run of consecutive items of \p input that are equal
+/// according to \p equal_to to \p output, in order, on \p stream, and writes their number to
+/// \p d_selected_count. \p d_storage must hold <tt>select_storage_size(size)</tt> bytes.
+template<typename Input, typename Output, typename EqualTo = select_equal_to>
+void unique(const Input         input,
+            const Output        output,
+            const size_t        size,
+            unsigned long long* d_selected_count,
+            void*               d_storage,
+            hipStream_t         stream   = hipStreamDefault,
+            const EqualTo       equal_to = EqualTo{})
+{
+    select_items<false>(unique_load<Input, EqualTo>{input, equal_to},
+                        input,
+                        output,
+                        size,
+                        d_selected_count,
+                        d_storage,
+                        stream);
+}
+
+/// \brief Copies the \p size items of \p input to \p output on \p stream: the items that satisfy
+/// \p predicate in order at the start, and the other items in reverse order at the end. Writes the
+/// number of selected items to \p d_selected_count. \p d_storage must hold
+/// <tt>select_storage_size(size)</tt> bytes.
+template<typename Input, typename Output, typename Predicate>
+void partition(const Input         input,
+               const Output        output,
+               const size_t        size,
+               const Predicate     predicate,
+               unsigned long long* d_selected_count,
+               void*               d_storage,
+               hipStream_t         stream = hipStreamDefault)
+{
+    select_items<true>(select_if_load<Input, Predicate>{input, predicate},
+                       input,
+                       output,
+                       size,
+                       d_selected_count,
+                       d_storage,
+                       stream);
+}
+
+/// \brief Reverses the items of \p output after the first <tt>*d_selected_count</tt> ones, in
+/// place. The number of items is only known on the device.
+template<typename Output>
+__global__ void reverse_rejected_items(const Output                    output,
+                                       const size_t                    size,
+                                       const unsigned long long* const d_selected_count)
+{
+    const size_t begin = *d_selected_count;
+    const size_t index = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if(index < (size - begin) / 2)
+    {
+        const auto front = output[begin + index];
+        output.store(begin + index, output[size - 1 - index]);
+        output.store(size - 1 - index, front);
+    }
+}
+
+/// \brief Copies the \p size items of \p input to \p output on \p stream: the items that satisfy
+/// \p predicate at the start and the other items after them, both in order. Writes the number of
+/// selected items to \p d_selected_count. The rejected items are written in reverse order by
+/// \p partition, and then reversed, since their position is only known once all items are
+/// scanned. \p d_storage must hold <tt>select_storage_size(size)</tt> bytes.
+template<typename Input, typename Output, typename Predicate>
+void stable_partition(const Input         input,
+                      const Output        output,
+                      const size_t        size,
+                      const Predicate     predicate,
+                      unsigned long long* d_selected_count,
+                      void*               d_storage,
+                      hipStream_t         stream = hipStreamDefault)
+{
+    partition(input, output, size, predicate, d_selected_count, d_storage, stream);
+
+    constexpr unsigned int block_size = 256;
+    const size_t           grid_size  = ceiling_div(size / 2, block_size);
+    if(grid_size > 0)
+    {
+        reverse_rejected_items<<<static_cast<unsigned int>(grid_size), block_size, 0, stream>>>(
+            output,
+            size,
+            d_selected_count);
+        HIP_CHECK(hipGetLastError());
+    }
+}
+
+/// \brief Selection counts of a three-way partition: one for the items of the first part and one
+/// for the items of the second part.
+struct three_way_count
+{
+    unsigned long long first;
+    unsigned long long second;
+};
+
+/// \brief Scan operator of the selection counts of a three-way partition.
+struct three_way_count_op
+{
+    __host__ __device__ three_way_count operator()(const three_way_count& lhs,
+                                                   const three_way_count& rhs) const
+    {
+        return {selection_count_op{}(lhs.first, rhs.first),
+                selection_count_op{}(lhs.second, rhs.second)};
+    }
+};
+
+/// \brief Evaluates the predicates of \p three_way_partition on every item. An item that satisfies
+/// both belongs to the first part.
+template<typename Input, typename FirstPredicate, typename SecondPredicate>
+struct three_way_partition_load
+{
+    Input           input;
+    FirstPredicate  first_predicate;
+    SecondPredicate second_predicate;
+
+    __device__ three_way_count operator()(const size_t index) const
+    {
+        const auto item = input[index];
+        if(first_predicate(item))
+        {
+            return {selection_flag | 1, 0};
+        }
+        return {0, second_predicate(item) ? selection_flag | 1 : 0};
+    }
+};
+
+/// \brief Writes every item of \p three_way_partition to the output of its part, and the number of
+/// items of the first and the second part to \p d_selected_counts with the last item.
+template<typename Input, typename Output>
+struct three_way_partition_store
+{
+    Input               input;
+    Output              first_output;
+    Output              second_output;
+    Output              unselected_output;
+    size_t              size;
+    unsigned long long* d_selected_counts;
+
+    __device__ void operator()(const size_t index, const three_way_count& selection) const
+    {
+        const unsigned long long first_count  = selection.first & ~selection_flag;
+        const unsigned long long second_count = selection.second & ~selection_flag;
+        if(selection.first & selection_flag)
+        {
+            first_output.store(first_count - 1, input[index]);
+        }
+        else if(selection.second & selection_flag)
+        {
+            second_output.store(second_count - 1, input[index]);
+        }
+        else
+        {
+            unselected_output.store(index - first_count - second_count, input[index]);
+        }
+
+        if(index == size - 1)
+        {
+            d_selected_counts[0] = first_count;
+            d_selected_counts[1] = second_count;
+        }
+    }
+};
+
+/// \brief Returns the number of bytes of temporary storage required by \p three_way_partition for
+/// \p size items.
+inline size_t three_way_partition_storage_size(const size_t size)
+{
+    return scan_storage_size<three_way_count>(size);
+}
+
+/// \brief Splits the \p size items of \p input on \p stream into the items that satisfy
+/// \p first_predicate, written to \p first_output, the other items that satisfy
+/// \p second_predicate, written to \p second_output, and the remaining items, written to
+/// \p unselected_output, all in order. Writes the number of items of the first and the second part
+/// to \p d_selected_counts. \p d_storage must hold <tt>three_way_partition_storage_size(size)</tt>
+/// bytes.
+template<typename Input, typename Output, typename FirstPredicate, typename SecondPredicate>
+void three_way_partition(const Input           input,
+                         const Output          first_output,
+                         const Output          second_output,
+                         const Output          unselected_output,
+                         const size_t          size,
+                         const FirstPredicate  first_predicate,
+                         const SecondPredicate second_predicate,
+                         unsigned long long*   d_selected_counts,
+                         void*                 d_storage,
+                         hipStream_t           stream = hipStreamDefault)
+{
+    if(size == 0)
+    {
+        HIP_CHECK(hipMemsetAsync(d_selected_counts, 0, 2 * sizeof(unsigned long long), stream));
+        return;
+    }
+    single_pass_scan<false>(
+        three_way_partition_load<Input, FirstPredicate, SecondPredicate>{input,
+                                                                         first_predicate,
+                                                                         second_predicate},
+        three_way_partition_store<Input, Output>{input,
+                                                 first_output,
+                                                 second_output,
+                                                 unselected_output,
+                                                 size,
+                                                 d_selected_counts},
+        size,
+        three_way_count_op{},
+        three_way_count{},
+        d_storage,
+        stream);
+}
+
+#endif // APPLICATIONS_PREFIX_SUM_SELECT_HPP
@@ -0,0 +1,219 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef COMMON_GEMM_UTILS_HPP
+#define COMMON_GEMM_UTILS_HPP
+
+// A host matrix multiplication for computing the reference results of the BLAS examples at
+// realistic sizes. It has the stride-based interface of multiply_matrices in example_utils.hpp,
+// but blocks the matrices for the caches, packs the blocks into contiguous panels so the inner
+// loops can be vectorized by the compiler, and distributes the blocks of C across threads.
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/// \brief The sizes of the blocks of \p multiply_matrices_blocked. A micro-tile of
+/// \p gemm_micro_rows x \p gemm_micro_cols elements of C is accumulated in registers, from panels
+/// of A and B that are packed for \p gemm_block_depth values of k, which fit in the L1 cache. A
+/// block of C of \p gemm_block_rows x \p gemm_block_cols elements is computed by one thread, with
+/// the packed block of A kept in the L2 cache.
+constexpr int gemm_micro_rows  = 8;
+constexpr int gemm_micro_cols  = 4;
+constexpr int gemm_block_rows  = 128;
+constexpr int gemm_block_cols  = 256;
+constexpr int gemm_block_depth = 256;
+
+/// \brief Computes the \p gemm_micro_rows x \p gemm_micro_cols tile of \p A * \p B of \p depth
+/// values of k, with \p A packed as <tt>A[k * gemm_micro_rows + row]</tt> and \p B packed as
+/// <tt>B[k * gemm_micro_cols + col]</tt>, and stores it to \p tile. As the loops have constant
+/// trip counts and consecutive accesses, the compiler can unroll and vectorize them.
+template<typename T>
+void multiply_micro_tile(const int depth,
+                         const T*  A,
+                         const T*  B,
+                         T (&tile)[gemm_micro_cols][gemm_micro_rows])
+{
+    for(int col = 0; col < gemm_micro_cols; ++col)
+    {
+        for(int row = 0; row < gemm_micro_rows; ++row)
+        {
+            tile[col][row] = T(0.0);
+        }
+    }
+    for(int k = 0; k < depth; ++k)
+    {
+        for(int col = 0; col < gemm_micro_cols; ++col)
+        {
+            for(int row = 0; row < gemm_micro_rows; ++row)
+            {
+                tile[col][row] += A[k * gemm_micro_rows + row] * B[k * gemm_micro_cols + col];
+            }
+        }
+    }
+}
+
+/// \brief Multiply an $A$ matrix ($m \times k$) with a $B$ matrix ($k \times n$) as:
+/// $C := \alpha \cdot A \cdot B + \beta \cdot C$, with the same interface as
+/// \p multiply_matrices: element $(i, l)$ of $A$ is <tt>A[i * stride1_a + l * stride2_a]</tt>,
+/// element $(l, j)$ of $B$ is <tt>B[l * stride1_b + j * stride2_b]</tt> and $C$ is column-major
+/// with leading dimension \p stride_c.
+///
+/// - C is divided into blocks of \p gemm_block_rows x \p gemm_block_cols elements, which are
+///   distributed across up to \p thread_count threads (0 for one per hardware thread). Small
+///   products are computed by the calling thread.
+/// - For each step of \p gemm_block_depth values of k, a thread packs the block of A into panels
+///   of \p gemm_micro_rows rows and the block of B into panels of \p gemm_micro_cols columns.
+///   The panels are padded with zeros, so every micro-tile is full.
+/// - The packed panels are contiguous, whatever the strides of A and B, so the micro-tiles read
+///   them sequentially.
+template<typename T>
+void multiply_matrices_blocked(T            alpha,
+                               T            beta,
+                               int          m,
+                               int          n,
+                               int          k,
+                               const T*     A,
+                               int          stride1_a,
+                               int          stride2_a,
+                               const T*     B,
+                               int          stride1_b,
+                               int          stride2_b,
+                               T*           C,
+                               int          stride_c,
+                               unsigned int thread_count = 0)
+{
+    const int row_blocks = (m + gemm_block_rows - 1) / gemm_block_rows;
+    const int col_blocks = (n + gemm_block_cols - 1) / gemm_block_cols;
+    const int blocks     = row_blocks * col_blocks;
+
+    std::atomic<int> next_block{0};
+    const auto       multiply_blocks = [&]
+    {
+        // The packed blocks of A and B, padded to full panels.
+        std::vector<T> a_packed(gemm_block_rows * gemm_block_depth);
+        std::vector<T> b_packed(gemm_block_cols * gemm_block_depth);
+        T              tile[gemm_micro_cols][gemm_micro_rows];
+
+        for(int block = next_block++; block < blocks; block = next_block++)
+        {
+            const int row_begin = block % row_blocks * gemm_block_rows;
+            const int col_begin = block / row_blocks * gemm_block_cols;
+            const int rows      = std::min(gemm_block_rows, m - row_begin);
+            const int cols      = std::min(gemm_block_cols, n - col_begin);
+
+            // C is scaled by beta before the first step, so the steps only add to it.
+            for(int j = col_begin; j < col_begin + cols; ++j)
+            {
+                for(int i = row_begin; i < row_begin + rows; ++i)
+                {
+                    C[i + j * stride_c] = beta * C[i + j * stride_c];
+                }
+            }
+
+            for(int depth_begin = 0; depth_begin < k; depth_begin += gemm_block_depth)
+            {
+                const int depth = std::min(gemm_block_depth, k - depth_begin);
+
+                for(int panel = 0; panel < rows; panel += gemm_micro_rows)
+                {
+                    T* a_panel = a_packed.data() + panel * depth;
+                    for(int l = 0; l < depth; ++l)
+                    {
+                        for(int row = 0; row < gemm_micro_rows; ++row)
+                        {
+                            const int i = row_begin + panel + row;
+                            a_panel[l * gemm_micro_rows + row]
+                                = panel + row < rows
+                                      ? A[i * stride1_a + (depth_begin + l) * stride2_a]
+                                      : T(0.0);
+                        }
+                    }
+                }
+
+                for(int panel = 0; panel < cols; panel += gemm_micro_cols)
+                {
+                    T* b_panel = b_packed.data() + panel * depth;
+                    for(int l = 0; l < depth; ++l)
+                    {
+                        for(int col = 0; col < gemm_micro_cols; ++col)
+                        {
+                            const int j = col_begin + panel + col;
+                            b_panel[l * gemm_micro_cols + col]
+                                = panel + col < cols
+                                      ? B[(depth_begin + l) * stride1_b + j * stride2_b]
+                                      : T(0.0);
+                        }
+                    }
+                }
+
+                for(int col_panel = 0; col_panel < cols; col_panel += gemm_micro_cols)
+                {
+                    for(int row_panel = 0; row_panel < rows; row_panel += gemm_micro_rows)
+                    {
+                        multiply_micro_tile(depth,
+                                            a_packed.data() + row_panel * depth,
+                                            b_packed.data() + col_panel * depth,
+                                            tile);
+
+                        const int tile_rows = std::min(gemm_micro_rows, rows - row_panel);
+                        const int tile_cols = std::min(gemm_micro_cols, cols - col_panel);
+                        for(int col = 0; col < tile_cols; ++col)
+                        {
+                            const int j = col_begin + col_panel + col;
+                            for(int row = 0; row < tile_rows; ++row)
+                            {
+                                const int i = row_begin + row_panel + row;
+                                C[i + j * stride_c] += alpha * tile[col][row];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    // Threads only pay off if every thread gets at least a few blocks of work.
+    constexpr double min_operations_per_thread = 1 << 22;
+    if(thread_count == 0)
+    {
+        thread_count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    thread_count = static_cast<unsigned int>(std::min<double>(
+        {static_cast<double>(thread_count),
+         static_cast<double>(blocks),
+         std::max(1., static_cast<double>(m) * n * k / min_operations_per_thread)}));
+
+    std::vector<std::thread> threads;
+    for(unsigned int t = 1; t < thread_count; ++t)
+    {
+        threads.emplace_back(multiply_blocks);
+    }
+    multiply_blocks();
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+#endif // COMMON_GEMM_UTILS_HPP
@@ -0,0 +1,963 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef COMMON_SPARSE_IO_UTILS_HPP
+#define COMMON_SPARSE_IO_UTILS_HPP
+
+// Loaders of sparse matrices and graphs stored in text files (DIMACS shortest path graphs, edge
+// lists and Matrix Market coordinate matrices). The files are memory-mapped and parsed in parallel
+// chunks into COO format, which is then converted to CSR with a parallel counting sort. The CSR
+// matrix can be cached in a binary file next to the source file, so that reloading it only
+// requires a copy from the (memory-mapped) cache.
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// \brief Sparse matrix in coordinate (COO) format: entry \p i has value \p val[i] and is located
+/// at row \p row_ind[i] and column \p col_ind[i]. Indices are zero-based.
+template<typename I, typename T>
+struct coo_matrix
+{
+    I              rows{};
+    I              cols{};
+    std::vector<I> row_ind;
+    std::vector<I> col_ind;
+    std::vector<T> val;
+};
+
+/// \brief Sparse matrix in compressed sparse row (CSR) format, with the same layout used by the
+/// rocSPARSE examples: the entries of row \p i are <tt>[row_ptr[i], row_ptr[i + 1])</tt> of
+/// \p col_ind and \p val. The column indices of each row are sorted.
+template<typename I, typename T>
+struct csr_matrix
+{
+    I              rows{};
+    I              cols{};
+    std::vector<I> row_ptr;
+    std::vector<I> col_ind;
+    std::vector<T> val;
+
+    I nnz() const
+    {
+        return static_cast<I>(col_ind.size());
+    }
+};
+
+/// \brief Formats of the files read by \p load_csr_matrix.
+enum class sparse_file_format
+{
+    /// Lines <tt>u v [w]</tt> with zero-based nodes. Lines starting with '#' or '%' are comments.
+    edge_list,
+    /// DIMACS graph: a problem line <tt>p sp n m</tt> followed by arcs <tt>a u v w</tt> (or
+    /// undirected edges <tt>e u v</tt> of weight 1, stored in both directions) with one-based
+    /// nodes. Lines starting with 'c' are comments.
+    dimacs,
+    /// Matrix Market coordinate matrix (real, integer or pattern; general, symmetric or
+    /// skew-symmetric) with one-based indices.
+    matrix_market,
+    /// Binary CSR cache written by \p write_csr_cache.
+    binary_csr
+};
+
+/// \brief Returns the format of the file \p path, deduced from its extension: '.gr' for DIMACS,
+/// '.mtx' for Matrix Market, '.csr' for binary CSR and an edge list otherwise.
+inline sparse_file_format sparse_file_format_from_path(const std::string& path)
+{
+    const std::string extension = std::filesystem::path(path).extension().string();
+    if(extension == ".gr")
+    {
+        return sparse_file_format::dimacs;
+    }
+    if(extension == ".mtx")
+    {
+        return sparse_file_format::matrix_market;
+    }
+    if(extension == ".csr")
+    {
+        return sparse_file_format::binary_csr;
+    }
+    return sparse_file_format::edge_list;
+}
+
+/// \brief Read-only memory mapping of a whole file.
+class mapped_file
+{
+public:
+    explicit mapped_file(const std::string& path)
+    {
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(),
+                           GENERIC_READ,
+                           FILE_SHARE_READ,
+                           nullptr,
+                           OPEN_EXISTING,
+                           FILE_FLAG_SEQUENTIAL_SCAN,
+                           nullptr);
+        LARGE_INTEGER file_size;
+        if(file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &file_size))
+        {
+            unmap();
+            throw std::runtime_error("Could not open file " + path);
+        }
+        mapped_size = static_cast<size_t>(file_size.QuadPart);
+        if(mapped_size > 0)
+        {
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            mapped_data
+                = mapping ? static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0))
+                          : nullptr;
+            if(mapped_data == nullptr)
+            {
+                unmap();
+                throw std::runtime_error("Could not map file " + path);
+            }
+        }
+#else
+        file = open(path.c_str(), O_RDONLY);
+        struct stat file_status;
+        if(file < 0 || fstat(file, &file_status) != 0)
+        {
+            unmap();
+            throw std::runtime_error("Could not open file " + path);
+        }
+        mapped_size = static_cast<size_t>(file_status.st_size);
+        if(mapped_size > 0)
+        {
+            void* address = mmap(nullptr, mapped_size, PROT_READ, MAP_PRIVATE, file, 0);
+            if(address == MAP_FAILED)
+            {
+                unmap();
+                throw std::runtime_error("Could not map file " + path);
+            }
+            mapped_data = static_cast<const char*>(address);
+            // The file is read from beginning to end, so the kernel may read ahead aggressively.
+            madvise(address, mapped_size, MADV_SEQUENTIAL);
+        }
+#endif
+    }
+
+    ~mapped_file()
+    {
+        unmap();
+    }
+
+    mapped_file(const mapped_file&)            = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    const char* data() const
+    {
+        return mapped_data;
+    }
+
+    size_t size() const
+    {
+        return mapped_size;
+    }
+
+private:
+    void unmap()
+    {
+#ifdef _WIN32
+        if(mapped_data != nullptr)
+        {
+            UnmapViewOfFile(mapped_data);
+        }
+        if(mapping != nullptr)
+        {
+            CloseHandle(mapping);
+        }
+        if(file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file);
+        }
+        mapping = nullptr;
+        file    = INVALID_HANDLE_VALUE;
+#else
+        if(mapped_data != nullptr)
+        {
+            munmap(const_cast<char*>(mapped_data), mapped_size);
+        }
+        if(file >= 0)
+        {
+            close(file);
+        }
+        file = -1;
+#endif
+        mapped_data = nullptr;
+    }
+
+#ifdef _WIN32
+    HANDLE file    = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int file = -1;
+#endif
+    const char* mapped_data = nullptr;
+    size_t      mapped_size = 0;
+};
+
+/// \brief Returns the number of host threads used by default to load the files.
+inline unsigned int default_loader_threads()
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/// \brief Splits <tt>[0, size)</tt> into \p threads contiguous ranges and calls
+/// <tt>function(begin, end, thread_index)</tt> for each of them on its own thread. An exception
+/// thrown by any of the calls is rethrown on the calling thread.
+template<typename Function>
+void parallel_for_ranges(const size_t size, const unsigned int threads, Function function)
+{
+    std::vector<std::thread>        workers;
+    std::vector<std::exception_ptr> exceptions(threads);
+    for(unsigned int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back(
+            [&, t]
+            {
+                try
+                {
+                    function(size * t / threads, size * (t + 1) / threads, t);
+                }
+                catch(...)
+                {
+                    exceptions[t] = std::current_exception();
+                }
+            });
+    }
+    for(std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    for(const std::exception_ptr& exception : exceptions)
+    {
+        if(exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+namespace sparse_io_detail
+{
+
+/// \brief Header of the binary CSR cache. The size and modification time of the source file are
+/// stored to detect stale caches, and the tags of the index and value types to detect caches
+/// written with other types.
+struct csr_cache_header
+{
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t index_type;
+    std::uint32_t value_type;
+    std::uint32_t reserved;
+    std::int64_t  source_size;
+    std::int64_t  source_time;
+    std::uint64_t rows;
+    std::uint64_t cols;
+    std::uint64_t nnz;
+};
+
+constexpr char          csr_cache_magic[8] = {'C', 'S', 'R', 'C', 'A', 'C', 'H', 'E'};
+constexpr std::uint32_t csr_cache_version  = 2;
+
+/// \brief Returns the tag of the arithmetic type \p T in the CSR cache: its size, and whether it is
+/// a floating-point type and whether it is signed. Types of the same size, such as \p int and
+/// \p float, have different tags.
+template<typename T>
+constexpr std::uint32_t csr_cache_type_tag()
+{
+    static_assert(std::is_arithmetic<T>::value, "The CSR cache only stores arithmetic types");
+    return static_cast<std::uint32_t>(sizeof(T))
+           | (std::is_floating_point<T>::value ? 1U << 8 : 0U)
+           | (std::is_signed<T>::value ? 1U << 9 : 0U);
+}
+
+/// \brief Properties of a text file, read from its header before the entries are parsed.
+struct text_header
+{
+    unsigned long long rows{};
+    unsigned long long cols{};
+    bool               pattern{};
+    bool               symmetric{};
+    bool               skew_symmetric{};
+    // Offset of the first line after the header.
+    size_t body_offset{};
+};
+
+inline bool is_blank(const char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline const char* skip_blanks(const char* p, const char* end)
+{
+    while(p < end && is_blank(*p))
+    {
+        ++p;
+    }
+    return p;
+}
+
+inline const char* next_line(const char* p, const char* end)
+{
+    const void* newline = std::memchr(p, '\n', end - p);
+    return newline ? static_cast<const char*>(newline) + 1 : end;
+}
+
+/// \brief Returns the line starting at \p p, without the line break.
+inline std::string line_text(const char* p, const char* end)
+{
+    const char* line_end = next_line(p, end);
+    if(line_end > p && line_end[-1] == '\n')
+    {
+        --line_end;
+    }
+    return std::string(p, line_end);
+}
+
+/// \brief Returns whether \p value can be represented by the index type \p I.
+template<typename I>
+bool fits_index(const unsigned long long value)
+{
+    return value <= static_cast<unsigned long long>(std::numeric_limits<I>::max());
+}
+
+/// \brief Parses an unsigned integer starting at \p p. Returns false if there is none.
+inline bool parse_unsigned(const char*& p, const char* end, unsigned long long& value)
+{
+    p = skip_blanks(p, end);
+    if(p == end || !std::isdigit(static_cast<unsigned char>(*p)))
+    {
+        return false;
+    }
+    value = 0;
+    while(p < end && std::isdigit(static_cast<unsigned char>(*p)))
+    {
+        value = value * 10 + static_cast<unsigned long long>(*p - '0');
+        ++p;
+    }
+    return true;
+}
+
+/// \brief Parses a real number starting at \p p. Returns false if there is none.
+inline bool parse_real(const char*& p, const char* end, double& value)
+{
+    p = skip_blanks(p, end);
+
+    // The mapped file is not null-terminated, so the token is copied before converting it.
+    char   token[64];
+    size_t length = 0;
+    while(p + length < end && !is_blank(p[length]) && p[length] != '\n'
+          && length < sizeof(token) - 1)
+    {
+        token[length] = p[length];
+        ++length;
+    }
+    token[length] = '\0';
+
+    char* token_end;
+    value = std::strtod(token, &token_end);
+    p += token_end - token;
+    return token_end != token;
+}
+
+/// \brief Returns the line starting at \p p, without the line break, in lowercase.
+inline std::string lowercase_line(const char* p, const char* end)
+{
+    std::string line(p, next_line(p, end));
+    std::transform(line.begin(),
+                   line.end(),
+                   line.begin(),
+                   [](const char c) { return static_cast<char>(std::tolower(c)); });
+    while(!line.empty() && std::isspace(static_cast<unsigned char>(line.back())))
+    {
+        line.pop_back();
+    }
+    return line;
+}
+
+/// \brief Reads the banner and the size line of a Matrix Market file.
+inline text_header read_matrix_market_header(const char* data, const char* end)
+{
+    text_header        header;
+    const std::string  banner = lowercase_line(data, end);
+    const std::string  prefix = "%%matrixmarket matrix coordinate";
+    if(banner.compare(0, prefix.size(), prefix) != 0)
+    {
+        throw std::runtime_error("Only Matrix Market coordinate matrices are supported");
+    }
+    if(banner.find("complex") != std::string::npos || banner.find("hermitian") != std::string::npos)
+    {
+        throw std::runtime_error("Complex Matrix Market matrices are not supported");
+    }
+    header.pattern        = banner.find("pattern") != std::string::npos;
+    header.skew_symmetric = banner.find("skew-symmetric") != std::string::npos;
+    header.symmetric      = !header.skew_symmetric && banner.find("symmetric") != std::string::npos;
+
+    for(const char* p = next_line(data, end); p < end; p = next_line(p, end))
+    {
+        const char* q = skip_blanks(p, end);
+        if(q == end || *q == '\n' || *q == '%')
+        {
+            continue;
+        }
+        unsigned long long entries;
+        if(!parse_unsigned(q, end, header.rows) || !parse_unsigned(q, end, header.cols)
+           || !parse_unsigned(q, end, entries))
+        {
+            throw std::runtime_error("Invalid Matrix Market size line");
+        }
+        header.body_offset = next_line(p, end) - data;
+        return header;
+    }
+    throw std::runtime_error("Missing Matrix Market size line");
+}
+
+/// \brief Reads the comments and the problem line of a DIMACS file.
+inline text_header read_dimacs_header(const char* data, const char* end)
+{
+    text_header header;
+    for(const char* p = data; p < end; p = next_line(p, end))
+    {
+        const char* q = skip_blanks(p, end);
+        if(q == end || *q == '\n' || *q == 'c')
+        {
+            continue;
+        }
+        // Problem line 'p <type> <nodes> <edges>'.
+        const bool         problem_line = *q == 'p';
+        unsigned long long edges;
+        q = skip_blanks(q + 1, end);
+        while(q < end && !is_blank(*q) && *q != '\n')
+        {
+            ++q;
+        }
+        if(!problem_line || !parse_unsigned(q, end, header.rows)
+           || !parse_unsigned(q, end, edges))
+        {
+            throw std::runtime_error("Invalid or missing DIMACS problem line");
+        }
+        header.cols        = header.rows;
+        header.body_offset = next_line(p, end) - data;
+        return header;
+    }
+    throw std::runtime_error("Missing DIMACS problem line");
+}
+
+/// \brief Parses the entries of the lines in <tt>[begin, end)</tt> and appends them to
+/// \p entries. The largest zero-based index found is stored in \p max_index.
+template<typename I, typename T>
+void parse_entries(const char*            begin,
+                   const char*            end,
+                   const sparse_file_format format,
+                   const text_header&     header,
+                   coo_matrix<I, T>&      entries,
+                   unsigned long long&    max_index)
+{
+    // Edge lists are zero-based, the other formats are one-based.
+    const unsigned long long base = (format == sparse_file_format::edge_list) ? 0 : 1;
+
+    max_index = 0;
+    for(const char* p = begin; p < end; p = next_line(p, end))
+    {
+        const char* q = skip_blanks(p, end);
+        if(q == end || *q == '\n')
+        {
+            continue;
+        }
+
+        bool has_value  = true;
+        bool undirected = false;
+        if(format == sparse_file_format::dimacs)
+        {
+            // Only arc and edge lines hold entries, the others are comments. Edges are undirected
+            // and unweighted.
+            if(*q != 'a' && *q != 'e')
+            {
+                continue;
+            }
+            has_value  = (*q == 'a');
+            undirected = (*q == 'e');
+            ++q;
+        }
+        else if(format == sparse_file_format::matrix_market)
+        {
+            if(*q == '%')
+            {
+                continue;
+            }
+            has_value = !header.pattern;
+        }
+        else if(*q == '#' || *q == '%')
+        {
+            continue;
+        }
+
+        unsigned long long row;
+        unsigned long long col;
+        if(!parse_unsigned(q, end, row) || !parse_unsigned(q, end, col) || row < base
+           || col < base)
+        {
+            throw std::runtime_error("Invalid entry: " + line_text(p, end));
+        }
+        row -= base;
+        col -= base;
+
+        double value = 1.0;
+        if(has_value)
+        {
+            // In edge lists the weight is optional. The value is only replaced if it is parsed,
+            // so edges without a weight keep the weight 1.
+            double parsed_value;
+            if(parse_real(q, end, parsed_value))
+            {
+                value = parsed_value;
+            }
+            else if(format != sparse_file_format::edge_list)
+            {
+                throw std::runtime_error("Missing value: " + line_text(p, end));
+            }
+        }
+
+        if(format != sparse_file_format::edge_list && (row >= header.rows || col >= header.cols))
+        {
+            throw std::runtime_error("Entry out of bounds: " + line_text(p, end));
+        }
+        if(!fits_index<I>(row) || !fits_index<I>(col))
+        {
+            throw std::runtime_error("Index does not fit in the index type");
+        }
+        max_index = std::max(max_index, std::max(row, col));
+
+        entries.row_ind.push_back(static_cast<I>(row));
+        entries.col_ind.push_back(static_cast<I>(col));
+        entries.val.push_back(static_cast<T>(value));
+
+        // Symmetric matrices only store the lower triangle, and undirected edges are stored once.
+        if((header.symmetric || header.skew_symmetric || undirected) && row != col)
+        {
+            entries.row_ind.push_back(static_cast<I>(col));
+            entries.col_ind.push_back(static_cast<I>(row));
+            entries.val.push_back(static_cast<T>(header.skew_symmetric ? -value : value));
+        }
+    }
+}
+
+} // namespace sparse_io_detail
+
+/// \brief Parses the text file mapped in \p file into COO format, splitting it into one chunk of
+/// lines per thread.
+template<typename I, typename T>
+coo_matrix<I, T> parse_coo_matrix(const mapped_file&       file,
+                                  const sparse_file_format format,
+                                  const unsigned int       threads = default_loader_threads())
+{
+    using namespace sparse_io_detail;
+
+    const char* data = file.data();
+    const char* end  = data + file.size();
+
+    text_header header;
+    if(format == sparse_file_format::matrix_market)
+    {
+        header = read_matrix_market_header(data, end);
+    }
+    else if(format == sparse_file_format::dimacs)
+    {
+        header = read_dimacs_header(data, end);
+    }
+    if(!fits_index<I>(header.rows) || !fits_index<I>(header.cols))
+    {
+        throw std::runtime_error("Matrix dimensions do not fit in the index type");
+    }
+
+    // Chunks start at the first line that begins inside of them.
+    const char*              body = data + header.body_offset;
+    const size_t             size = end - body;
+    std::vector<const char*> chunk_begin(threads + 1, end);
+    for(unsigned int t = 0; t < threads; ++t)
+    {
+        const char* p  = body + size * t / threads;
+        chunk_begin[t] = (p == body || p[-1] == '\n') ? p : next_line(p, end);
+    }
+
+    std::vector<coo_matrix<I, T>>   chunks(threads);
+    std::vector<unsigned long long> max_index(threads);
+    parallel_for_ranges(threads,
+                        threads,
+                        [&](size_t, size_t, const unsigned int t)
+                        {
+                            parse_entries(chunk_begin[t],
+                                          chunk_begin[t + 1],
+                                          format,
+                                          header,
+                                          chunks[t],
+                                          max_index[t]);
+                        });
+
+    // Concatenate the entries of the chunks in order.
+    std::vector<size_t> chunk_offset(threads + 1, 0);
+    for(unsigned int t = 0; t < threads; ++t)
+    {
+        chunk_offset[t + 1] = chunk_offset[t] + chunks[t].val.size();
+    }
+
+    coo_matrix<I, T> matrix;
+    matrix.row_ind.resize(chunk_offset[threads]);
+    matrix.col_ind.resize(chunk_offset[threads]);
+    matrix.val.resize(chunk_offset[threads]);
+    parallel_for_ranges(threads,
+                        threads,
+                        [&](size_t, size_t, const unsigned int t)
+                        {
+                            std::copy(chunks[t].row_ind.begin(),
+                                      chunks[t].row_ind.end(),
+                                      matrix.row_ind.begin() + chunk_offset[t]);
+                            std::copy(chunks[t].col_ind.begin(),
+                                      chunks[t].col_ind.end(),
+                                      matrix.col_ind.begin() + chunk_offset[t]);
+                            std::copy(chunks[t].val.begin(),
+                                      chunks[t].val.end(),
+                                      matrix.val.begin() + chunk_offset[t]);
+                            chunks[t] = coo_matrix<I, T>();
+                        });
+
+    if(format == sparse_file_format::edge_list)
+    {
+        // The number of nodes of an edge list is given by the largest node found.
+        const unsigned long long nodes
+            = matrix.val.empty() ? 0 : *std::max_element(max_index.begin(), max_index.end()) + 1;
+        if(!fits_index<I>(nodes))
+        {
+            throw std::runtime_error("Number of nodes does not fit in the index type");
+        }
+        header.rows = header.cols = nodes;
+    }
+    matrix.rows = static_cast<I>(header.rows);
+    matrix.cols = static_cast<I>(header.cols);
+    return matrix;
+}
+
+/// \brief Converts \p coo to CSR format with a parallel counting sort: the entries of each row are
+/// counted with atomic counters, the counts are scanned into the row pointers and the entries are
+/// scattered to their rows. Finally, the entries of each row are sorted by column.
+template<typename I, typename T>
+csr_matrix<I, T> coo_to_csr(const coo_matrix<I, T>& coo,
+                            const unsigned int      threads = default_loader_threads())
+{
+    const size_t nnz  = coo.val.size();
+    const size_t rows = coo.rows;
+    if(!sparse_io_detail::fits_index<I>(nnz))
+    {
+        throw std::runtime_error("Number of entries does not fit in the index type");
+    }
+
+    csr_matrix<I, T> csr;
+    csr.rows = coo.rows;
+    csr.cols = coo.cols;
+    csr.row_ptr.resize(rows + 1);
+    csr.col_ind.resize(nnz);
+    csr.val.resize(nnz);
+
+    // 1. Count the entries of each row.
+    std::unique_ptr<std::atomic<size_t>[]> cursor(new std::atomic<size_t>[rows]);
+    parallel_for_ranges(rows,
+                        threads,
+                        [&](const size_t begin, const size_t end, unsigned int)
+                        {
+                            for(size_t row = begin; row < end; ++row)
+                            {
+                                cursor[row].store(0, std::memory_order_relaxed);
+                            }
+                        });
+    parallel_for_ranges(nnz,
+                        threads,
+                        [&](const size_t begin, const size_t end, unsigned int)
+                        {
+                            for(size_t i = begin; i < end; ++i)
+                            {
+                                cursor[coo.row_ind[i]].fetch_add(1, std::memory_order_relaxed);
+                            }
+                        });
+
+    // 2. Exclusive scan of the counts: each thread scans a range of rows, after adding the sum of
+    // the previous ranges. The cursors are left pointing to the beginning of each row.
+    std::vector<size_t> range_sum(threads + 1, 0);
+    parallel_for_ranges(rows,
+                        threads,
+                        [&](const size_t begin, const size_t end, const unsigned int t)
+                        {
+                            size_t sum = 0;
+                            for(size_t row = begin; row < end; ++row)
+                            {
+                                sum += cursor[row].load(std::memory_order_relaxed);
+                            }
+                            range_sum[t + 1] = sum;
+                        });
+    for(unsigned int t = 0; t < threads; ++t)
+    {
+        range_sum[t + 1] += range_sum[t];
+    }
+    parallel_for_ranges(rows,
+                        threads,
+                        [&](const size_t begin, const size_t end, const unsigned int t)
+                        {
+                            size_t offset = range_sum[t];
+                            for(size_t row = begin; row < end; ++row)
+                            {
+                                const size_t count = cursor[row].load(std::memory_order_relaxed);
+                                csr.row_ptr[row]   = static_cast<I>(offset);
+                                cursor[row].store(offset, std::memory_order_relaxed);
+                                offset += count;
+                            }
+                        });
+    csr.row_ptr[rows] = static_cast<I>(nnz);
+
+    // 3. Scatter the entries to their rows.
+    parallel_for_ranges(nnz,
+                        threads,
+                        [&](const size_t begin, const size_t end, unsigned int)
+                        {
+                            for(size_t i = begin; i < end; ++i)
+                            {
+                                const size_t position
+                                    = cursor[coo.row_ind[i]].fetch_add(1,
+                                                                       std::memory_order_relaxed);
+                                csr.col_ind[position] = coo.col_ind[i];
+                                csr.val[position]     = coo.val[i];
+                            }
+                        });
+
+    // 4. The order of the entries inside of each row depends on the scheduling of the threads, so
+    // sort them by column (and value, for repeated entries) to obtain a deterministic result.
+    parallel_for_ranges(rows,
+                        threads,
+                        [&](const size_t begin, const size_t end, unsigned int)
+                        {
+                            std::vector<std::pair<I, T>> row_entries;
+                            for(size_t row = begin; row < end; ++row)
+                            {
+                                const size_t row_begin = csr.row_ptr[row];
+                                const size_t row_end   = csr.row_ptr[row + 1];
+                                row_entries.clear();
+                                for(size_t i = row_begin; i < row_end; ++i)
+                                {
+                                    row_entries.emplace_back(csr.col_ind[i], csr.val[i]);
+                                }
+                                std::sort(row_entries.begin(), row_entries.end());
+                                for(size_t i = row_begin; i < row_end; ++i)
+                                {
+                                    csr.col_ind[i] = row_entries[i - row_begin].first;
+                                    csr.val[i]     = row_entries[i - row_begin].second;
+                                }
+                            }
+                        });
+
+    return csr;
+}
+
+/// \brief Returns the path of the binary CSR cache of the file \p path.
+inline std::string csr_cache_path(const std::string& path)
+{
+    return path + ".csr";
+}
+
+/// \brief Returns the size and modification time of the file \p path, which identify the version
+/// of the source file a cache was created from.
+inline std::pair<std::int64_t, std::int64_t> file_signature(const std::string& path)
+{
+    const std::filesystem::path file(path);
+    return {static_cast<std::int64_t>(std::filesystem::file_size(file)),
+            static_cast<std::int64_t>(
+                std::filesystem::last_write_time(file).time_since_epoch().count())};
+}
+
+/// \brief Reads the binary CSR file mapped in \p file. If \p source_path is not empty, the cache
+/// is only accepted if it was created from the current version of that file. Returns false if the
+/// cache is not valid.
+template<typename I, typename T>
+bool read_csr_cache(const mapped_file& file, const std::string& source_path, csr_matrix<I, T>& csr)
+{
+    using namespace sparse_io_detail;
+
+    csr_cache_header header;
+    if(file.size() < sizeof(header))
+    {
+        return false;
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+    if(std::memcmp(header.magic, csr_cache_magic, sizeof(header.magic)) != 0
+       || header.version != csr_cache_version || header.index_type != csr_cache_type_tag<I>()
+       || header.value_type != csr_cache_type_tag<T>()
+       || file.size()
+              != sizeof(header) + (header.rows + 1 + header.nnz) * sizeof(I)
+                     + header.nnz * sizeof(T))
+    {
+        return false;
+    }
+    if(!source_path.empty()
+       && file_signature(source_path)
+              != std::make_pair(header.source_size, header.source_time))
+    {
+        return false;
+    }
+
+    csr.rows = static_cast<I>(header.rows);
+    csr.cols = static_cast<I>(header.cols);
+    csr.row_ptr.resize(header.rows + 1);
+    csr.col_ind.resize(header.nnz);
+    csr.val.resize(header.nnz);
+
+    const char* p = file.data() + sizeof(header);
+    std::memcpy(csr.row_ptr.data(), p, csr.row_ptr.size() * sizeof(I));
+    p += csr.row_ptr.size() * sizeof(I);
+    std::memcpy(csr.col_ind.data(), p, csr.col_ind.size() * sizeof(I));
+    p += csr.col_ind.size() * sizeof(I);
+    std::memcpy(csr.val.data(), p, csr.val.size() * sizeof(T));
+    return true;
+}
+
+/// \brief Writes \p csr to the binary CSR cache of the file \p source_path. The cache is written
+/// to a temporary file that is then renamed, so that an interrupted write never leaves a partial
+/// cache behind. Returns false if the cache could not be written.
+template<typename I, typename T>
+bool write_csr_cache(const std::string& source_path, const csr_matrix<I, T>& csr)
+{
+    using namespace sparse_io_detail;
+
+    csr_cache_header header{};
+    std::memcpy(header.magic, csr_cache_magic, sizeof(header.magic));
+    header.version    = csr_cache_version;
+    header.index_type = csr_cache_type_tag<I>();
+    header.value_type = csr_cache_type_tag<T>();
+    std::tie(header.source_size, header.source_time) = file_signature(source_path);
+    header.rows = csr.rows;
+    header.cols = csr.cols;
+    header.nnz  = csr.nnz();
+
+    const std::string cache_path     = csr_cache_path(source_path);
+    const std::string temporary_path = cache_path + ".tmp";
+    {
+        std::ofstream output(temporary_path, std::ios::binary | std::ios::trunc);
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char*>(csr.row_ptr.data()),
+                     csr.row_ptr.size() * sizeof(I));
+        output.write(reinterpret_cast<const char*>(csr.col_ind.data()),
+                     csr.col_ind.size() * sizeof(I));
+        output.write(reinterpret_cast<const char*>(csr.val.data()), csr.val.size() * sizeof(T));
+        if(!output)
+        {
+            output.close();
+            std::error_code error;
+            std::filesystem::remove(temporary_path, error);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary_path, cache_path, error);
+    return !error;
+}
+
+/// \brief Loads the sparse matrix or graph stored in the file \p path in CSR format, where the
+/// format of the file is deduced from its extension. If \p use_cache is set, a valid binary CSR
+/// cache next to the file is loaded instead of the file itself and, if there is none, it is
+/// created after parsing the file. If \p loaded_from_cache is not null, it is set to whether the
+/// cache was used.
+template<typename I, typename T>
+csr_matrix<I, T> load_csr_matrix(const std::string& path,
+                                 const bool         use_cache         = true,
+                                 const unsigned int threads           = default_loader_threads(),
+                                 bool*              loaded_from_cache = nullptr)
+{
+    const sparse_file_format format = sparse_file_format_from_path(path);
+
+    csr_matrix<I, T> csr;
+    if(format == sparse_file_format::binary_csr)
+    {
+        if(!read_csr_cache(mapped_file(path), "", csr))
+        {
+            throw std::runtime_error("Invalid binary CSR file " + path);
+        }
+        if(loaded_from_cache != nullptr)
+        {
+            *loaded_from_cache = true;
+        }
+        return csr;
+    }
+
+    if(use_cache && std::filesystem::exists(csr_cache_path(path))
+       && read_csr_cache(mapped_file(csr_cache_path(path)), path, csr))
+    {
+        if(loaded_from_cache != nullptr)
+        {
+            *loaded_from_cache = true;
+        }
+        return csr;
+    }
+
+    {
+        const mapped_file file(path);
+        csr = coo_to_csr(parse_coo_matrix<I, T>(file, format, threads), threads);
+    }
+    if(use_cache)
+    {
+        // The cache is an optimization only: failing to write it is not an error.
+        write_csr_cache(path, csr);
+    }
+    if(loaded_from_cache != nullptr)
+    {
+        *loaded_from_cache = false;
+    }
+    return csr;
+}
+
+#endif // COMMON_SPARSE_IO_UTILS_HPP
@@ -0,0 +1,259 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIP_BASIC_BANDWIDTH_HOST_STREAM_HPP
+#define HIP_BASIC_BANDWIDTH_HOST_STREAM_HPP
+
+#include "example_utils.hpp"
+#include "measurement.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define HOST_STREAM_NON_TEMPORAL_STORES 1
+#else
+    #define HOST_STREAM_NON_TEMPORAL_STORES 0
+#endif
+
+/// \brief The kernels of the STREAM benchmark, which measure the bandwidth of the host memory.
+enum class HostStreamKernel : unsigned int
+{
+    // c = a
+    COPY,
+    // b = scalar * c
+    SCALE,
+    // c = a + b
+    ADD,
+    // a = b + scalar * c
+    TRIAD
+};
+
+/// \brief Returns the name of \p kernel.
+inline std::string host_stream_kernel_name(const HostStreamKernel kernel)
+{
+    switch(kernel)
+    {
+        case HostStreamKernel::COPY: return "Copy";
+        case HostStreamKernel::SCALE: return "Scale";
+        case HostStreamKernel::ADD: return "Add";
+        case HostStreamKernel::TRIAD: return "Triad";
+    }
+    return "";
+}
+
+/// \brief Returns the number of arrays \p kernel reads or writes, which all have the same size.
+inline unsigned int host_stream_kernel_arrays(const HostStreamKernel kernel)
+{
+    return kernel == HostStreamKernel::COPY || kernel == HostStreamKernel::SCALE ? 2 : 3;
+}
+
+/// \brief A barrier for a fixed number of threads that spins instead of sleeping, so the threads
+/// start every trial at the same time.
+class SpinBarrier
+{
+public:
+    explicit SpinBarrier(const unsigned int thread_count) : thread_count(thread_count) {}
+
+    void arrive_and_wait()
+    {
+        const unsigned int generation = this->generation.load(std::memory_order_acquire);
+        if(arrived.fetch_add(1, std::memory_order_acq_rel) + 1 == thread_count)
+        {
+            arrived.store(0, std::memory_order_relaxed);
+            this->generation.store(generation + 1, std::memory_order_release);
+        }
+        else
+        {
+            while(this->generation.load(std::memory_order_acquire) == generation)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    const unsigned int        thread_count;
+    std::atomic<unsigned int> arrived{0};
+    std::atomic<unsigned int> generation{0};
+};
+
+/// \brief Stores <tt>element(i)</tt> to <tt>dst[i]</tt> for the elements <tt>[begin, end)</tt>.
+/// With non-temporal stores, the elements up to the first aligned pair are stored regularly, and
+/// pairs of elements are stored with \p _mm_stream_pd, which does not read the destination into
+/// the caches.
+template<bool NonTemporal, typename Element>
+void host_stream_loop(double* dst, size_t begin, const size_t end, Element element)
+{
+#if HOST_STREAM_NON_TEMPORAL_STORES
+    if(NonTemporal)
+    {
+        for(; begin < end && reinterpret_cast<uintptr_t>(dst + begin) % 16 != 0; begin++)
+        {
+            dst[begin] = element(begin);
+        }
+        for(; begin + 2 <= end; begin += 2)
+        {
+            _mm_stream_pd(dst + begin, _mm_set_pd(element(begin + 1), element(begin)));
+        }
+        _mm_sfence();
+    }
+#endif
+    for(size_t i = begin; i < end; i++)
+    {
+        dst[i] = element(i);
+    }
+}
+
+/// \brief Runs \p kernel on the elements <tt>[begin, end)</tt> of the arrays.
+template<bool NonTemporal>
+void run_host_stream_kernel(const HostStreamKernel kernel,
+                            double*                a,
+                            double*                b,
+                            double*                c,
+                            const double           scalar,
+                            const size_t           begin,
+                            const size_t           end)
+{
+    switch(kernel)
+    {
+        case HostStreamKernel::COPY:
+            host_stream_loop<NonTemporal>(c, begin, end, [=](const size_t i) { return a[i]; });
+            break;
+        case HostStreamKernel::SCALE:
+            host_stream_loop<NonTemporal>(b,
+                                          begin,
+                                          end,
+                                          [=](const size_t i) { return scalar * c[i]; });
+            break;
+        case HostStreamKernel::ADD:
+            host_stream_loop<NonTemporal>(c,
+                                          begin,
+                                          end,
+                                          [=](const size_t i) { return a[i] + b[i]; });
+            break;
+        case HostStreamKernel::TRIAD:
+            host_stream_loop<NonTemporal>(a,
+                                          begin,
+                                          end,
+                                          [=](const size_t i) { return b[i] + scalar * c[i]; });
+            break;
+    }
+}
+
+/// \brief Run the STREAM \p kernel on arrays of doubles of every size, in bytes per array, split
+/// across \p thread_count host threads. The threads stay alive for all trials of a size, and a
+/// trial is timed from the barrier all threads start it at to the barrier all threads finish it
+/// at. As no device is involved, the host time is used as the event time as well. Each thread
+/// initializes its part of the arrays, so with a first-touch policy its pages are placed on the
+/// NUMA node of the thread.
+template<bool NonTemporal>
+std::vector<TransferTimings>
+    run_bandwidth_host_stream(const std::vector<size_t>& memory_copy_measurement_sizes,
+                              const HostStreamKernel     kernel,
+                              const unsigned int         thread_count,
+                              const unsigned int         trails,
+                              const unsigned int         warmups)
+{
+    constexpr double scalar = 3.0;
+
+    // The timings of the trials will be stored in timing_measurements
+    std::vector<TransferTimings> timing_measurements;
+
+    std::cout << "Measuring Host " << host_stream_kernel_name(kernel)
+              << (NonTemporal ? " Non-temporal" : "") << " Bandwidth (" << thread_count
+              << " threads): " << std::flush;
+    for(auto size : memory_copy_measurement_sizes)
+    {
+        std::cout << "[" << size << "] " << std::flush;
+
+        const size_t element_count = std::max<size_t>(size / sizeof(double), 1);
+        const size_t size_in_bytes = element_count * sizeof(double);
+
+        TransferTimings timings{size, host_stream_kernel_arrays(kernel) * size_in_bytes, {}, {}};
+        timings.host_seconds.resize(trails);
+
+        // The arrays are not value-initialized, so the pages are touched by the threads first.
+        const std::unique_ptr<double[]> a(new double[element_count]);
+        const std::unique_ptr<double[]> b(new double[element_count]);
+        const std::unique_ptr<double[]> c(new double[element_count]);
+
+        SpinBarrier              barrier(thread_count);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < thread_count; t++)
+        {
+            threads.emplace_back(
+                [&, t]
+                {
+                    HostClock    host_clock;
+                    const size_t begin = element_count * t / thread_count;
+                    const size_t end   = element_count * (t + 1) / thread_count;
+                    for(size_t i = begin; i < end; i++)
+                    {
+                        a[i] = 1.0;
+                        b[i] = 2.0;
+                        c[i] = 0.0;
+                    }
+
+                    // The first warmups iterations are the warm up
+                    for(unsigned int i = 0; i < warmups + trails; i++)
+                    {
+                        barrier.arrive_and_wait();
+                        host_clock.reset_timer();
+                        host_clock.start_timer();
+                        run_host_stream_kernel<NonTemporal>(kernel,
+                                                            a.get(),
+                                                            b.get(),
+                                                            c.get(),
+                                                            scalar,
+                                                            begin,
+                                                            end);
+                        barrier.arrive_and_wait();
+                        host_clock.stop_timer();
+                        if(t == 0 && i >= warmups)
+                        {
+                            timings.host_seconds[i - warmups] = host_clock.get_elapsed_time();
+                        }
+                    }
+                });
+        }
+        for(std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        timings.event_seconds = timings.host_seconds;
+        timing_measurements.emplace_back(std::move(timings));
+    }
+    std::cout << std::endl;
+
+    return timing_measurements;
+}
+
+#endif // HIP_BASIC_BANDWIDTH_HOST_STREAM_HPP
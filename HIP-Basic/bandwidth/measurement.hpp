@@ -0,0 +1,451 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIP_BASIC_BANDWIDTH_MEASUREMENT_HPP
+#define HIP_BASIC_BANDWIDTH_MEASUREMENT_HPP
+
+#include "example_utils.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/// \brief Times each trial of a transfer with the host clock and with events. The start event is
+/// recorded on the first stream and every stream waits for it, so the trial starts on all streams
+/// at once. Every stream records a stop event. The streams are split in groups, such as the two
+/// directions of a bidirectional transfer, and the event time of a group is the time until its
+/// last stream completes.
+class TrialTimer
+{
+public:
+    explicit TrialTimer(const std::vector<std::vector<hipStream_t>>& stream_groups)
+        : stream_groups(stream_groups), stop_events(stream_groups.size())
+    {
+        HIP_CHECK(hipEventCreate(&start_event));
+        for(size_t group = 0; group < stream_groups.size(); group++)
+        {
+            stop_events[group].resize(stream_groups[group].size());
+            for(hipEvent_t& stop_event : stop_events[group])
+            {
+                HIP_CHECK(hipEventCreate(&stop_event));
+            }
+        }
+    }
+
+    explicit TrialTimer(const std::vector<hipStream_t>& streams)
+        : TrialTimer(std::vector<std::vector<hipStream_t>>{streams})
+    {}
+
+    TrialTimer(const TrialTimer&)            = delete;
+    TrialTimer& operator=(const TrialTimer&) = delete;
+
+    ~TrialTimer()
+    {
+        for(const std::vector<hipEvent_t>& group_stop_events : stop_events)
+        {
+            for(const hipEvent_t stop_event : group_stop_events)
+            {
+                HIP_CHECK(hipEventDestroy(stop_event));
+            }
+        }
+        HIP_CHECK(hipEventDestroy(start_event));
+    }
+
+    /// \brief Starts the host clock and records the start event.
+    void start()
+    {
+        host_clock.reset_timer();
+        host_clock.start_timer();
+        HIP_CHECK(hipEventRecord(start_event, stream_groups[0][0]));
+        for(const std::vector<hipStream_t>& streams : stream_groups)
+        {
+            for(const hipStream_t stream : streams)
+            {
+                HIP_CHECK(hipStreamWaitEvent(stream, start_event, 0));
+            }
+        }
+    }
+
+    /// \brief Records the stop events, waits until all streams complete and stops the host clock.
+    void stop()
+    {
+        for(size_t group = 0; group < stream_groups.size(); group++)
+        {
+            for(size_t i = 0; i < stream_groups[group].size(); i++)
+            {
+                HIP_CHECK(hipEventRecord(stop_events[group][i], stream_groups[group][i]));
+            }
+        }
+        for(const std::vector<hipEvent_t>& group_stop_events : stop_events)
+        {
+            for(const hipEvent_t stop_event : group_stop_events)
+            {
+                HIP_CHECK(hipEventSynchronize(stop_event));
+            }
+        }
+        host_clock.stop_timer();
+    }
+
+    /// \brief Returns the time of the last trial in seconds, measured by the host clock.
+    double host_seconds() const
+    {
+        return host_clock.get_elapsed_time();
+    }
+
+    /// \brief Returns the time of the last trial in seconds, from the start event to the last stop
+    /// event of the streams of \p group.
+    double event_seconds(const size_t group = 0) const
+    {
+        float max_elapsed_ms = 0;
+        for(const hipEvent_t stop_event : stop_events[group])
+        {
+            float elapsed_ms;
+            HIP_CHECK(hipEventElapsedTime(&elapsed_ms, start_event, stop_event));
+            max_elapsed_ms = std::max(max_elapsed_ms, elapsed_ms);
+        }
+        return max_elapsed_ms / 1e3;
+    }
+
+private:
+    std::vector<std::vector<hipStream_t>> stream_groups;
+    hipEvent_t                            start_event;
+    std::vector<std::vector<hipEvent_t>>  stop_events;
+    HostClock                             host_clock;
+};
+
+/// \brief The time of every trial of the transfers of one size.
+struct TransferTimings
+{
+    /// Size of the transfer in bytes.
+    size_t size;
+    /// Number of bytes transferred by a trial. More than the size when both directions are
+    /// measured together.
+    size_t bytes;
+    /// Time of every trial in seconds, measured by the host clock. Includes the overhead of the
+    /// API calls and the synchronization.
+    std::vector<double> host_seconds;
+    /// Time of every trial in seconds, measured by events.
+    std::vector<double> event_seconds;
+};
+
+/// \brief Statistics of the times of the trials of a transfer, in seconds.
+struct TimingStatistics
+{
+    double first;
+    double min;
+    double p50;
+    double p90;
+    double p99;
+    double max;
+    double mean;
+    /// Number of trials outside of the fences of Tukey: more than 1.5 times the interquartile
+    /// range below the first quartile or above the third quartile.
+    size_t outliers;
+};
+
+/// \brief Returns the \p percentile of the sorted \p values with the nearest-rank method.
+inline double nearest_rank_percentile(const std::vector<double>& sorted_values,
+                                      const double               percentile)
+{
+    const size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sorted_values.size()));
+    return sorted_values[std::max<size_t>(rank, 1) - 1];
+}
+
+/// \brief Returns the statistics of the trial times \p seconds, which are not empty.
+inline TimingStatistics compute_timing_statistics(const std::vector<double>& seconds)
+{
+    std::vector<double> sorted_seconds(seconds);
+    std::sort(sorted_seconds.begin(), sorted_seconds.end());
+
+    TimingStatistics statistics;
+    statistics.first = seconds.front();
+    statistics.min   = sorted_seconds.front();
+    statistics.p50   = nearest_rank_percentile(sorted_seconds, 50);
+    statistics.p90   = nearest_rank_percentile(sorted_seconds, 90);
+    statistics.p99   = nearest_rank_percentile(sorted_seconds, 99);
+    statistics.max   = sorted_seconds.back();
+
+    double sum = 0;
+    for(const double time : seconds)
+    {
+        sum += time;
+    }
+    statistics.mean = sum / seconds.size();
+
+    const double first_quartile = nearest_rank_percentile(sorted_seconds, 25);
+    const double third_quartile = nearest_rank_percentile(sorted_seconds, 75);
+    const double fence          = 1.5 * (third_quartile - first_quartile);
+
+    statistics.outliers = 0;
+    for(const double time : seconds)
+    {
+        if(time < first_quartile - fence || time > third_quartile + fence)
+        {
+            statistics.outliers++;
+        }
+    }
+    return statistics;
+}
+
+/// \brief Returns the bandwidth in GB/s of transferring \p bytes in \p seconds. Returns NaN if
+/// the time is not positive, as for a transfer shorter than the resolution of the events.
+inline double bandwidth_gbps(const double bytes, const double seconds)
+{
+    return seconds > 0 ? bytes / seconds / 1e9 : std::numeric_limits<double>::quiet_NaN();
+}
+
+/// \brief Returns the average bandwidth in GB/s of the trials of \p timings, from their event
+/// times.
+inline double average_bandwidth(const TransferTimings& timings)
+{
+    double total_seconds = 0;
+    for(const double time : timings.event_seconds)
+    {
+        total_seconds += time;
+    }
+    return bandwidth_gbps(static_cast<double>(timings.bytes) * timings.event_seconds.size(),
+                          total_seconds);
+}
+
+/// \brief The timings of a configuration of the benchmark for every size.
+struct BandwidthResult
+{
+    /// Device the transfers are issued on, or -1 for measurements of the host memory only.
+    int                          device;
+    std::string                  device_name;
+    /// NUMA node the host thread and memory are bound to, or -1 if they are not bound.
+    int                          numa_node;
+    /// Kind of host memory, "pageable", "pinned" or "mapped", or "device" for transfers between
+    /// device memory.
+    std::string                  memory;
+    /// Kind of transfer, such as "Host to Device".
+    std::string                  transfer;
+    unsigned int                 streams;
+    std::vector<TransferTimings> timings;
+    /// Device the transfers go to, for transfers between two devices, or -1.
+    int                          peer_device = -1;
+    /// Number of host threads the transfers are run by.
+    unsigned int                 threads     = 1;
+};
+
+/// \brief Prints the latency and bandwidth statistics of every size of \p result as a table.
+inline void print_latency_table(const BandwidthResult& result)
+{
+    std::cout << std::setw(12) << "size (B)" << std::setw(10) << "first" << std::setw(10)
+              << "min" << std::setw(10) << "p50" << std::setw(10) << "p90" << std::setw(10)
+              << "p99" << std::setw(10) << "max" << std::setw(12) << "host p50" << std::setw(12)
+              << "GB/s p50" << std::setw(10) << "outliers"
+              << "  (latencies in us)\n";
+    for(const TransferTimings& timings : result.timings)
+    {
+        const TimingStatistics event = compute_timing_statistics(timings.event_seconds);
+        const TimingStatistics host  = compute_timing_statistics(timings.host_seconds);
+        std::cout << std::fixed << std::setprecision(2) << std::setw(12) << timings.size
+                  << std::setw(10) << event.first * 1e6 << std::setw(10) << event.min * 1e6
+                  << std::setw(10) << event.p50 * 1e6 << std::setw(10) << event.p90 * 1e6
+                  << std::setw(10) << event.p99 * 1e6 << std::setw(10) << event.max * 1e6
+                  << std::setw(12) << host.p50 * 1e6 << std::setw(12)
+                  << bandwidth_gbps(timings.bytes, event.p50) << std::setw(10) << event.outliers
+                  << "\n"
+                  << std::defaultfloat << std::setprecision(6);
+    }
+}
+
+/// \brief Names of the columns of the CSV output, one row per size of every result.
+constexpr const char* csv_header
+    = "device,device_name,peer_device,numa_node,memory,transfer,streams,threads,size,bytes,"
+      "trials,average_bandwidth_gbps,event_first_us,event_min_us,event_p50_us,event_p90_us,"
+      "event_p99_us,event_max_us,event_mean_us,event_outliers,host_first_us,host_min_us,"
+      "host_p50_us,host_p90_us,host_p99_us,host_max_us,host_mean_us,host_outliers,"
+      "bandwidth_min_gbps,bandwidth_p50_gbps,bandwidth_max_gbps";
+
+/// \brief Returns \p text as a CSV field between quotes, with its quotes doubled.
+inline std::string csv_string(const std::string& text)
+{
+    std::string quoted = "\"";
+    for(const char c : text)
+    {
+        quoted += c == '"' ? "\"\"" : std::string(1, c);
+    }
+    return quoted + '"';
+}
+
+/// \brief Writes the statistics of every size of \p results to \p path, in CSV. Throws
+/// \p std::runtime_error if the file cannot be written.
+inline void write_csv(const std::string& path, const std::vector<BandwidthResult>& results)
+{
+    std::ofstream output(path);
+    if(!output)
+    {
+        throw std::runtime_error("Could not open file " + path);
+    }
+
+    const auto write_statistics = [&](const TimingStatistics& statistics)
+    {
+        output << statistics.first * 1e6 << ',' << statistics.min * 1e6 << ','
+               << statistics.p50 * 1e6 << ',' << statistics.p90 * 1e6 << ','
+               << statistics.p99 * 1e6 << ',' << statistics.max * 1e6 << ','
+               << statistics.mean * 1e6 << ',' << statistics.outliers << ',';
+    };
+
+    output << csv_header << '\n' << std::setprecision(9);
+    for(const BandwidthResult& result : results)
+    {
+        for(const TransferTimings& timings : result.timings)
+        {
+            const TimingStatistics event = compute_timing_statistics(timings.event_seconds);
+            const TimingStatistics host  = compute_timing_statistics(timings.host_seconds);
+            output << result.device << ',' << csv_string(result.device_name) << ','
+                   << result.peer_device << ',' << result.numa_node << ',' << result.memory << ','
+                   << result.transfer << ',' << result.streams << ',' << result.threads << ','
+                   << timings.size << ',' << timings.bytes << ',' << timings.event_seconds.size()
+                   << ',' << average_bandwidth(timings) << ',';
+            write_statistics(event);
+            write_statistics(host);
+            output << bandwidth_gbps(timings.bytes, event.max) << ','
+                   << bandwidth_gbps(timings.bytes, event.p50) << ','
+                   << bandwidth_gbps(timings.bytes, event.min) << '\n';
+        }
+    }
+    if(!output)
+    {
+        throw std::runtime_error("Could not write file " + path);
+    }
+}
+
+/// \brief Returns \p text as a JSON string, between quotes, with quotes, backslashes and control
+/// characters escaped.
+inline std::string json_string(const std::string& text)
+{
+    std::ostringstream escaped;
+    escaped << '"';
+    for(const char c : text)
+    {
+        if(c == '"' || c == '\\')
+        {
+            escaped << '\\' << c;
+        }
+        else if(static_cast<unsigned char>(c) < 0x20)
+        {
+            escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                    << static_cast<int>(c) << std::dec << std::setfill(' ');
+        }
+        else
+        {
+            escaped << c;
+        }
+    }
+    escaped << '"';
+    return escaped.str();
+}
+
+/// \brief Returns \p value as a JSON number, or \p null if it is not finite, as JSON has no
+/// infinities or NaNs.
+inline std::string json_number(const double value)
+{
+    if(!std::isfinite(value))
+    {
+        return "null";
+    }
+    std::ostringstream number;
+    number << std::setprecision(9) << value;
+    return number.str();
+}
+
+/// \brief Writes \p values to \p output as a JSON array.
+inline void write_json_array(std::ostream& output, const std::vector<double>& values)
+{
+    output << '[';
+    for(size_t i = 0; i < values.size(); i++)
+    {
+        output << (i > 0 ? ", " : "") << values[i];
+    }
+    output << ']';
+}
+
+/// \brief Writes \p statistics to \p output as a JSON object, with the times in microseconds.
+inline void write_json_statistics(std::ostream& output, const TimingStatistics& statistics)
+{
+    output << "{\"first_us\": " << statistics.first * 1e6 << ", \"min_us\": "
+           << statistics.min * 1e6 << ", \"p50_us\": " << statistics.p50 * 1e6
+           << ", \"p90_us\": " << statistics.p90 * 1e6 << ", \"p99_us\": " << statistics.p99 * 1e6
+           << ", \"max_us\": " << statistics.max * 1e6 << ", \"mean_us\": " << statistics.mean * 1e6
+           << ", \"outliers\": " << statistics.outliers << '}';
+}
+
+/// \brief Writes every result to \p path in JSON, with the statistics and the time of every
+/// trial, in seconds, of every size. Throws \p std::runtime_error if the file cannot be written.
+inline void write_json(const std::string& path, const std::vector<BandwidthResult>& results)
+{
+    std::ofstream output(path);
+    if(!output)
+    {
+        throw std::runtime_error("Could not open file " + path);
+    }
+
+    output << std::setprecision(9) << "{\"results\": [";
+    for(size_t r = 0; r < results.size(); r++)
+    {
+        const BandwidthResult& result = results[r];
+        output << (r > 0 ? "," : "") << "\n  {\"device\": " << result.device
+               << ", \"device_name\": " << json_string(result.device_name)
+               << ", \"peer_device\": " << result.peer_device
+               << ", \"numa_node\": " << result.numa_node
+               << ", \"memory\": " << json_string(result.memory)
+               << ", \"transfer\": " << json_string(result.transfer)
+               << ", \"streams\": " << result.streams << ", \"threads\": " << result.threads
+               << ", \"sizes\": [";
+        for(size_t s = 0; s < result.timings.size(); s++)
+        {
+            const TransferTimings& timings = result.timings[s];
+            output << (s > 0 ? "," : "") << "\n    {\"size\": " << timings.size
+                   << ", \"bytes\": " << timings.bytes
+                   << ", \"average_bandwidth_gbps\": " << json_number(average_bandwidth(timings))
+                   << ", \"event\": ";
+            write_json_statistics(output, compute_timing_statistics(timings.event_seconds));
+            output << ", \"host\": ";
+            write_json_statistics(output, compute_timing_statistics(timings.host_seconds));
+            output << ",\n     \"event_seconds\": ";
+            write_json_array(output, timings.event_seconds);
+            output << ",\n     \"host_seconds\": ";
+            write_json_array(output, timings.host_seconds);
+            output << '}';
+        }
+        output << "]}";
+    }
+    output << "\n]}\n";
+    if(!output)
+    {
+        throw std::runtime_error("Could not write file " + path);
+    }
+}
+
+#endif // HIP_BASIC_BANDWIDTH_MEASUREMENT_HPP
@@ -0,0 +1,220 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIP_BASIC_BANDWIDTH_NUMA_BINDING_HPP
+#define HIP_BASIC_BANDWIDTH_NUMA_BINDING_HPP
+
+#include "example_utils.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+    #include <sched.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+// The NUMA topology is read from sysfs and the bindings are set with system calls, so the example
+// does not depend on libnuma. NUMA binding is only supported on Linux.
+
+/// \brief Parses a list of ranges such as "0-3,8,10-11", as found in sysfs, into the ids it
+/// contains. Throws \p std::runtime_error if the list is malformed.
+inline std::vector<int> parse_id_list(const std::string& list)
+{
+    std::vector<int> ids;
+    size_t           position = 0;
+    while(position < list.size() && !std::isspace(static_cast<unsigned char>(list[position])))
+    {
+        size_t    length;
+        const int first = std::stoi(list.substr(position), &length);
+        position += length;
+        int last = first;
+        if(position < list.size() && list[position] == '-')
+        {
+            last = std::stoi(list.substr(position + 1), &length);
+            position += length + 1;
+        }
+        if(first < 0 || last < first)
+        {
+            throw std::runtime_error("Invalid id list " + list);
+        }
+        for(int id = first; id <= last; id++)
+        {
+            ids.push_back(id);
+        }
+        if(position < list.size() && list[position] == ',')
+        {
+            position++;
+        }
+    }
+    return ids;
+}
+
+/// \brief Returns the contents of the first line of the file \p path, or an empty string if it
+/// cannot be read.
+inline std::string read_first_line(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string   line;
+    std::getline(file, line);
+    return line;
+}
+
+/// \brief Returns the ids of the NUMA nodes with memory of the system. Empty if the system does
+/// not expose its NUMA topology.
+inline std::vector<int> get_numa_nodes()
+{
+#if defined(__linux__)
+    const std::string nodes = read_first_line("/sys/devices/system/node/has_memory");
+    if(!nodes.empty())
+    {
+        return parse_id_list(nodes);
+    }
+    return parse_id_list(read_first_line("/sys/devices/system/node/online"));
+#else
+    return {};
+#endif
+}
+
+/// \brief Returns the ids of the CPUs of the NUMA node \p node.
+inline std::vector<int> get_numa_node_cpus(const int node)
+{
+    return parse_id_list(
+        read_first_line("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+}
+
+/// \brief Returns the NUMA node closest to the device \p device, or -1 if it is not known.
+inline int get_device_numa_node(const int device)
+{
+#if defined(__linux__)
+    char pci_bus_id[64];
+    HIP_CHECK(hipDeviceGetPCIBusId(pci_bus_id, sizeof(pci_bus_id), device));
+
+    // sysfs uses lowercase hexadecimal digits in the PCI addresses.
+    std::string address(pci_bus_id);
+    std::transform(address.begin(),
+                   address.end(),
+                   address.begin(),
+                   [](const unsigned char c) { return std::tolower(c); });
+
+    const std::string node = read_first_line("/sys/bus/pci/devices/" + address + "/numa_node");
+    return node.empty() ? -1 : std::stoi(node);
+#else
+    static_cast<void>(device);
+    return -1;
+#endif
+}
+
+/// \brief Binds the calling thread, and the host memory it allocates, to a NUMA node for its
+/// lifetime. The thread only runs on the CPUs of the node, and the memory policy of the thread
+/// only allows pages on the node, so pageable memory touched by the thread is placed on it. Pinned
+/// memory only follows the policy if it is allocated with \p hipHostMallocNumaUser, as HIP places
+/// it close to the device otherwise. The previous CPU affinity and the default memory policy are
+/// restored on destruction.
+class NumaBinding
+{
+public:
+    explicit NumaBinding(const int node)
+    {
+#if defined(__linux__)
+        if(sched_getaffinity(0, sizeof(previous_affinity), &previous_affinity) != 0)
+        {
+            throw std::runtime_error("Could not get the CPU affinity");
+        }
+
+        // Only the CPUs of the node the thread is allowed to run on are used, as the process may
+        // be restricted to a subset of the CPUs of the system.
+        cpu_set_t affinity;
+        CPU_ZERO(&affinity);
+        for(const int cpu : get_numa_node_cpus(node))
+        {
+            if(cpu < CPU_SETSIZE && CPU_ISSET(cpu, &previous_affinity))
+            {
+                CPU_SET(cpu, &affinity);
+            }
+        }
+        if(CPU_COUNT(&affinity) == 0)
+        {
+            throw std::runtime_error("No CPUs of NUMA node " + std::to_string(node)
+                                     + " are available");
+        }
+        cpu_count = CPU_COUNT(&affinity);
+        if(sched_setaffinity(0, sizeof(affinity), &affinity) != 0)
+        {
+            throw std::runtime_error("Could not bind to the CPUs of NUMA node "
+                                     + std::to_string(node));
+        }
+
+        // The node mask of set_mempolicy holds one bit per node. The kernel reads one bit less of
+        // the mask than the number of nodes passed, so one more is passed, as libnuma does.
+        constexpr int              bits_per_word = 8 * sizeof(unsigned long);
+        std::vector<unsigned long> node_mask(node / bits_per_word + 1);
+        node_mask[node / bits_per_word] = 1ul << (node % bits_per_word);
+        if(syscall(SYS_set_mempolicy, mpol_bind, node_mask.data(), node + 2) != 0)
+        {
+            sched_setaffinity(0, sizeof(previous_affinity), &previous_affinity);
+            throw std::runtime_error("Could not bind the memory policy to NUMA node "
+                                     + std::to_string(node));
+        }
+#else
+        static_cast<void>(node);
+        throw std::runtime_error("NUMA binding is only supported on Linux");
+#endif
+    }
+
+    /// \brief Returns the number of CPUs the thread is bound to.
+    unsigned int get_cpu_count() const
+    {
+        return cpu_count;
+    }
+
+    NumaBinding(const NumaBinding&)            = delete;
+    NumaBinding& operator=(const NumaBinding&) = delete;
+
+    ~NumaBinding()
+    {
+#if defined(__linux__)
+        syscall(SYS_set_mempolicy, mpol_default, nullptr, 0);
+        sched_setaffinity(0, sizeof(previous_affinity), &previous_affinity);
+#endif
+    }
+
+private:
+    unsigned int cpu_count = 0;
+
+#if defined(__linux__)
+    // Memory policy modes of set_mempolicy, as defined in numaif.h.
+    static constexpr int mpol_default = 0;
+    static constexpr int mpol_bind    = 2;
+
+    cpu_set_t previous_affinity;
+#endif
+};
+
+#endif // HIP_BASIC_BANDWIDTH_NUMA_BINDING_HPP
@@ -0,0 +1,277 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPBLAS_GEMM_STRIDED_BATCHED_SMALL_GEMM_BATCHED_HPP
+#define HIPBLAS_GEMM_STRIDED_BATCHED_SMALL_GEMM_BATCHED_HPP
+
+#include "example_utils.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cstddef>
+
+/// \brief The largest number of rows, columns and inner dimension supported by
+/// \p small_gemm_batched.
+constexpr int small_gemm_max_size = 32;
+
+/// \brief A batch of matrices that are \p stride elements apart, starting at \p data.
+template<typename T>
+struct strided_batch
+{
+    T*        data;
+    long long stride;
+
+    __device__ T* operator[](const int i) const
+    {
+        return data + i * stride;
+    }
+};
+
+/// \brief A batch of matrices whose addresses are stored in the device array \p pointers.
+template<typename T>
+struct pointer_array_batch
+{
+    T* const* pointers;
+
+    __device__ T* operator[](const int i) const
+    {
+        return pointers[i];
+    }
+};
+
+/// \brief Computes $C_i := \alpha \cdot A_i \cdot B_i + \beta \cdot C_i$ for the column-major
+/// matrices of the batches \p A, \p B and \p C, with $A_i$ an $m \times k$, $B_i$ a
+/// $k \times n$ and $C_i$ an $m \times n$ matrix, where \p m is at most \p MaxRows.
+///
+/// - Every matrix of C is computed by \p n threads, one per column, and a block of
+///   \p blockDim.x threads computes <tt>blockDim.x / n</tt> matrices.
+/// - The matrices A of the block are loaded to shared memory first, as all threads of a matrix
+///   read all of its A. A thread reads its column of B from global memory, and accumulates its
+///   column of C in registers, so every element of the operands is loaded only once.
+template<int MaxRows, typename BatchA, typename BatchB, typename BatchC>
+__global__ void small_gemm_batched_kernel(const int    m,
+                                          const int    n,
+                                          const int    k,
+                                          const float  alpha,
+                                          const BatchA A,
+                                          const int    lda,
+                                          const BatchB B,
+                                          const int    ldb,
+                                          const float  beta,
+                                          const BatchC C,
+                                          const int    ldc,
+                                          const int    batch_count)
+{
+    // The matrices A of the block, each stored without padding.
+    extern __shared__ float a_values[];
+
+    const int matrices_per_block = blockDim.x / n;
+    const int first_matrix       = blockIdx.x * matrices_per_block;
+    const int a_size             = m * k;
+
+    for(int index = threadIdx.x; index < matrices_per_block * a_size; index += blockDim.x)
+    {
+        const int matrix  = first_matrix + index / a_size;
+        const int element = index % a_size;
+        if(matrix < batch_count)
+        {
+            a_values[index] = A[matrix][element % m + element / m * lda];
+        }
+    }
+
+    // Synchronization is needed to make sure that all matrices are loaded before
+    // starting the calculation.
+    __syncthreads();
+
+    const int local_matrix = threadIdx.x / n;
+    const int matrix       = first_matrix + local_matrix;
+    const int col          = threadIdx.x % n;
+    if(local_matrix >= matrices_per_block || matrix >= batch_count)
+    {
+        return;
+    }
+
+    const float* a = a_values + local_matrix * a_size;
+    const float* b = B[matrix] + col * ldb;
+
+    // The column of C is the accumulation variable. The loops over its rows have a constant trip
+    // count, so the array is kept in registers.
+    float c[MaxRows] = {};
+    for(int l = 0; l < k; ++l)
+    {
+        const float b_value = b[l];
+        for(int row = 0; row < MaxRows; ++row)
+        {
+            if(row < m)
+            {
+                c[row] += a[row + l * m] * b_value;
+            }
+        }
+    }
+
+    float* c_col = C[matrix] + col * ldc;
+    for(int row = 0; row < MaxRows; ++row)
+    {
+        if(row < m)
+        {
+            c_col[row] = alpha * c[row] + beta * c_col[row];
+        }
+    }
+}
+
+/// \brief Launches \p small_gemm_batched_kernel with columns of C of \p MaxRows registers on
+/// \p stream. A block computes up to <tt>256 / n</tt> matrices, as many as the matrices A of the
+/// block fit in the shared memory of a block, and has \p n threads per matrix.
+template<int MaxRows, typename BatchA, typename BatchB, typename BatchC>
+void launch_small_gemm_batched_kernel(const int         m,
+                                      const int         n,
+                                      const int         k,
+                                      const float       alpha,
+                                      const BatchA      A,
+                                      const int         lda,
+                                      const BatchB      B,
+                                      const int         ldb,
+                                      const float       beta,
+                                      const BatchC      C,
+                                      const int         ldc,
+                                      const int         batch_count,
+                                      const hipStream_t stream)
+{
+    constexpr int max_block_size = 256;
+
+    int device, max_shared_size;
+    HIP_CHECK(hipGetDevice(&device));
+    HIP_CHECK(hipDeviceGetAttribute(&max_shared_size,
+                                    hipDeviceAttributeMaxSharedMemoryPerBlock,
+                                    device));
+
+    // A matrix A of at most 32 x 32 elements always fits, so every block has at least one matrix.
+    const size_t       a_bytes            = sizeof(float) * m * k;
+    const unsigned int matrices_per_block = static_cast<unsigned int>(
+        std::min<size_t>(max_block_size / n, max_shared_size / a_bytes));
+    const unsigned int block_size  = matrices_per_block * n;
+    const unsigned int grid_size   = ceiling_div(batch_count, matrices_per_block);
+    const size_t       shared_size = a_bytes * matrices_per_block;
+
+    small_gemm_batched_kernel<MaxRows>
+        <<<dim3(grid_size), dim3(block_size), shared_size, stream>>>(m,
+                                                                     n,
+                                                                     k,
+                                                                     alpha,
+                                                                     A,
+                                                                     lda,
+                                                                     B,
+                                                                     ldb,
+                                                                     beta,
+                                                                     C,
+                                                                     ldc,
+                                                                     batch_count);
+    // Check if the kernel launch was successful.
+    HIP_CHECK(hipGetLastError());
+}
+
+/// \brief Computes $C_i := \alpha \cdot A_i \cdot B_i + \beta \cdot C_i$ for the batches \p A,
+/// \p B and \p C on \p stream, with the number of registers of the columns of C chosen from \p m.
+/// All of \p m, \p n and \p k must be at most \p small_gemm_max_size.
+template<typename BatchA, typename BatchB, typename BatchC>
+void small_gemm_batched(const int         m,
+                        const int         n,
+                        const int         k,
+                        const float       alpha,
+                        const BatchA      A,
+                        const int         lda,
+                        const BatchB      B,
+                        const int         ldb,
+                        const float       beta,
+                        const BatchC      C,
+                        const int         ldc,
+                        const int         batch_count,
+                        const hipStream_t stream)
+{
+    if(m <= 4)
+    {
+        launch_small_gemm_batched_kernel<4>(m,
+                                            n,
+                                            k,
+                                            alpha,
+                                            A,
+                                            lda,
+                                            B,
+                                            ldb,
+                                            beta,
+                                            C,
+                                            ldc,
+                                            batch_count,
+                                            stream);
+    }
+    else if(m <= 8)
+    {
+        launch_small_gemm_batched_kernel<8>(m,
+                                            n,
+                                            k,
+                                            alpha,
+                                            A,
+                                            lda,
+                                            B,
+                                            ldb,
+                                            beta,
+                                            C,
+                                            ldc,
+                                            batch_count,
+                                            stream);
+    }
+    else if(m <= 16)
+    {
+        launch_small_gemm_batched_kernel<16>(m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             lda,
+                                             B,
+                                             ldb,
+                                             beta,
+                                             C,
+                                             ldc,
+                                             batch_count,
+                                             stream);
+    }
+    else
+    {
+        launch_small_gemm_batched_kernel<small_gemm_max_size>(m,
+                                                              n,
+                                                              k,
+                                                              alpha,
+                                                              A,
+                                                              lda,
+                                                              B,
+                                                              ldb,
+                                                              beta,
+                                                              C,
+                                                              ldc,
+                                                              batch_count,
+                                                              stream);
+    }
+}
+
+#endif // HIPBLAS_GEMM_STRIDED_BATCHED_SMALL_GEMM_BATCHED_HPP
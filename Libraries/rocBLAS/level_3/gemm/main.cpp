@@ -22,12 +22,16 @@
 
 #include "cmdparser.hpp"
 #include "example_utils.hpp"
+#include "gemm_utils.hpp"
 #include "rocblas_utils.hpp"
 
 #include <rocblas/rocblas.h>
 
 #include <hip/hip_runtime.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
@@ -43,6 +47,10 @@ int main(const int argc, const char** argv)
     parser.set_optional<int>("m", "m", 5, "Number of rows of matrices A and C");
     parser.set_optional<int>("n", "n", 5, "Number of columns of matrices B and C");
     parser.set_optional<int>("k", "k", 5, "Number of columns of matrix A and rows of B");
+    parser.set_optional<unsigned int>("i",
+                                      "iterations",
+                                      0,
+                                      "Number of timed runs of the multiplication, 0 for none");
     parser.run_and_exit_if_error();
 
     // Set sizes of matrices.
@@ -50,6 +58,9 @@ int main(const int argc, const char** argv)
     const rocblas_int n = parser.get<int>("n");
     const rocblas_int k = parser.get<int>("k");
 
+    // Number of timed runs of the multiplication.
+    const unsigned int iterations = parser.get<unsigned int>("i");
+
     // Check input values validity.
     if(m <= 0)
     {
@@ -124,20 +135,57 @@ int main(const int argc, const char** argv)
     // Initialize gold standard matrix.
     h_gold = h_c;
 
-    // Calculate gold standard on CPU.
-    multiply_matrices<float>(h_alpha,
-                             h_beta,
-                             m,
-                             n,
-                             k,
-                             h_a.data(),
-                             stride1_a,
-                             stride2_a,
-                             h_b.data(),
-                             stride1_b,
-                             stride2_b,
-                             h_gold.data(),
-                             ldc);
+    // Calculate gold standard on CPU, with the cache-blocked multithreaded implementation.
+    const auto host_start = std::chrono::steady_clock::now();
+    multiply_matrices_blocked<float>(h_alpha,
+                                     h_beta,
+                                     m,
+                                     n,
+                                     k,
+                                     h_a.data(),
+                                     stride1_a,
+                                     stride2_a,
+                                     h_b.data(),
+                                     stride1_b,
+                                     stride2_b,
+                                     h_gold.data(),
+                                     ldc);
+    const auto host_end = std::chrono::steady_clock::now();
+
+    // When timing, compare the host implementation with the naive triple loop, which must give the
+    // same result up to rounding.
+    if(iterations > 0)
+    {
+        std::vector<float> h_naive = h_c;
+        const auto         naive_start = std::chrono::steady_clock::now();
+        multiply_matrices<float>(h_alpha,
+                                 h_beta,
+                                 m,
+                                 n,
+                                 k,
+                                 h_a.data(),
+                                 stride1_a,
+                                 stride2_a,
+                                 h_b.data(),
+                                 stride1_b,
+                                 stride2_b,
+                                 h_naive.data(),
+                                 ldc);
+        const auto naive_end = std::chrono::steady_clock::now();
+
+        const double blocked_ms
+            = std::chrono::duration<double, std::milli>(host_end - host_start).count();
+        const double naive_ms
+            = std::chrono::duration<double, std::milli>(naive_end - naive_start).count();
+        float max_difference = 0.f;
+        for(rocblas_int i = 0; i < size_c; ++i)
+        {
+            max_difference = std::max(max_difference, std::fabs(h_naive[i] - h_gold[i]));
+        }
+        std::cout << "Host reference: naive " << naive_ms << " ms, blocked " << blocked_ms
+                  << " ms (" << naive_ms / blocked_ms << "x), max difference " << max_difference
+                  << std::endl;
+    }
 
     // Allocate device memory.
     float* d_a{};
@@ -187,6 +235,46 @@ int main(const int argc, const char** argv)
     // Fetch device memory results, automatically blocked until results ready
     HIP_CHECK(hipMemcpy(h_c.data(), d_c, sizeof(float) * size_c, hipMemcpyDeviceToHost));
 
+    // Time the multiplication, so its throughput can be compared with other implementations, such
+    // as the kernels of the HIP-Basic matrix multiplication example. The first run above serves as
+    // the warm-up, and the result of the timed runs is not used.
+    if(iterations > 0)
+    {
+        hipEvent_t start, stop;
+        HIP_CHECK(hipEventCreate(&start));
+        HIP_CHECK(hipEventCreate(&stop));
+
+        HIP_CHECK(hipEventRecord(start));
+        for(unsigned int i = 0; i < iterations; ++i)
+        {
+            ROCBLAS_CHECK(rocblas_sgemm(handle,
+                                        trans_a,
+                                        trans_b,
+                                        m,
+                                        n,
+                                        k,
+                                        &h_alpha,
+                                        d_a,
+                                        lda,
+                                        d_b,
+                                        ldb,
+                                        &h_beta,
+                                        d_c,
+                                        ldc));
+        }
+        HIP_CHECK(hipEventRecord(stop));
+        HIP_CHECK(hipEventSynchronize(stop));
+
+        float elapsed_ms;
+        HIP_CHECK(hipEventElapsedTime(&elapsed_ms, start, stop));
+        const double average_ms = elapsed_ms / iterations;
+        std::cout << "rocblas_sgemm: " << average_ms << " ms "
+                  << 2. * m * n * k / (average_ms * 1e6) << " GFLOP/s" << std::endl;
+
+        HIP_CHECK(hipEventDestroy(stop));
+        HIP_CHECK(hipEventDestroy(start));
+    }
+
     // Destroy the rocBLAS handle.
     ROCBLAS_CHECK(rocblas_destroy_handle(handle));
 
@@ -22,6 +22,7 @@
 
 #include "cmdparser.hpp"
 #include "example_utils.hpp"
+#include "gemm_utils.hpp"
 #include "rocblas_utils.hpp"
 
 #include <rocblas/rocblas.h>
@@ -147,22 +148,22 @@ int main(const int argc, const char** argv)
     // Initialize gold standard matrix.
     h_gold = h_c;
 
-    // Calculate gold standard on CPU.
+    // Calculate gold standard on CPU, with the cache-blocked multithreaded implementation.
     for(rocblas_int i = 0; i < batch_count; ++i)
     {
-        multiply_matrices<float>(h_alpha,
-                                 h_beta,
-                                 m,
-                                 n,
-                                 k,
-                                 h_a.data() + i * stride_a,
-                                 stride1_a,
-                                 stride2_a,
-                                 h_b.data() + i * stride_b,
-                                 stride1_b,
-                                 stride2_b,
-                                 h_gold.data() + i * stride_c,
-                                 ldc);
+        multiply_matrices_blocked<float>(h_alpha,
+                                         h_beta,
+                                         m,
+                                         n,
+                                         k,
+                                         h_a.data() + i * stride_a,
+                                         stride1_a,
+                                         stride2_a,
+                                         h_b.data() + i * stride_b,
+                                         stride1_b,
+                                         stride2_b,
+                                         h_gold.data() + i * stride_c,
+                                         ldc);
     }
 
     // Allocate device memory.
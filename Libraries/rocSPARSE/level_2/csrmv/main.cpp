@@ -1,6 +1,6 @@
 // MIT License
 //
-// Copyright (c) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2023-2026 Advanced Micro Devices, Inc. All rights reserved.
 //
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
@@ -20,18 +20,35 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include "cmdparser.hpp"
 #include "example_utils.hpp"
 #include "rocsparse_utils.hpp"
+#include "sparse_io_utils.hpp"
 
 #include <rocsparse/rocsparse.h>
 
 #include <hip/hip_runtime.h>
 
-#include <array>
+#include <algorithm>
+#include <cmath>
+#include <exception>
 #include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
 
-int main()
+int main(int argc, char* argv[])
 {
+    // Parse user input.
+    cli::Parser parser(argc, argv);
+    parser.set_optional<std::string>("f",
+                                     "file",
+                                     "",
+                                     "Matrix Market (.mtx) file with the matrix A. By default, the "
+                                     "4x3 matrix of the example is used.");
+    parser.run_and_exit_if_error();
+    const std::string file = parser.get<std::string>("f");
+
     // 1. Set up input data
     //
     // alpha *      op(A)        *    x    + beta *    y    =      y
@@ -42,22 +59,48 @@ int main()
     //         ( 7.0  0.0  8.0 ) *                  ( 7.0 ) = ( 123.8 )
 
     // Set up CSR matrix
+    csr_matrix<rocsparse_int, double> A;
+    if(file.empty())
+    {
+        // Number of rows and columns
+        A.rows = 4;
+        A.cols = 3;
+
+        // CSR values
+        A.val = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+
+        // CSR row indices
+        A.row_ptr = {0, 2, 4, 6, 8};
+
+        // CSR column indices
+        A.col_ind = {0, 2, 0, 2, 0, 1, 0, 2};
+    }
+    else
+    {
+        // Load the matrix from the file, or from its binary cache if it has been loaded before.
+        try
+        {
+            A = load_csr_matrix<rocsparse_int, double>(file);
+        }
+        catch(const std::exception& exception)
+        {
+            std::cerr << "Could not load the matrix from " << file << ": " << exception.what()
+                      << std::endl;
+            return error_exit_code;
+        }
+    }
 
     // Number of rows and columns
-    constexpr rocsparse_int m = 4;
-    constexpr rocsparse_int n = 3;
+    const rocsparse_int m = A.rows;
+    const rocsparse_int n = A.cols;
 
     // Number of non-zero elements
-    constexpr rocsparse_int nnz = 8;
-
-    // CSR values
-    constexpr std::array<double, nnz> h_csr_val = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
-
-    // CSR row indices
-    constexpr std::array<rocsparse_int, m + 1> h_csr_row_ptr = {0, 2, 4, 6, 8};
+    const rocsparse_int nnz = A.nnz();
 
-    // CSR column indices
-    constexpr std::array<rocsparse_int, nnz> h_csr_col_ind = {0, 2, 0, 2, 0, 1, 0, 2};
+    // CSR values, row indices and column indices
+    const std::vector<double>&        h_csr_val     = A.val;
+    const std::vector<rocsparse_int>& h_csr_row_ptr = A.row_ptr;
+    const std::vector<rocsparse_int>& h_csr_col_ind = A.col_ind;
 
     // Transposition of the matrix
     constexpr rocsparse_operation trans = rocsparse_operation_none;
@@ -66,9 +109,29 @@ int main()
     constexpr double alpha = 3.7;
     constexpr double beta  = 1.3;
 
-    // Set up x and y vectors
-    constexpr std::array<double, n> h_x = {1.0, 2.0, 3.0};
-    std::array<double, m>           h_y = {4.0, 5.0, 6.0, 7.0};
+    // Set up x and y vectors: x = (1, 2, 3, ...) and y = (4, 5, 6, ...)
+    std::vector<double> h_x(n);
+    std::vector<double> h_y(m);
+    for(rocsparse_int i = 0; i < n; ++i)
+    {
+        h_x[i] = 1.0 + i % 16;
+    }
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        h_y[i] = 4.0 + i % 16;
+    }
+
+    // Compute the expected result on the host.
+    std::vector<double> expected_y(m);
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        double sum = 0.0;
+        for(rocsparse_int j = h_csr_row_ptr[i]; j < h_csr_row_ptr[i + 1]; ++j)
+        {
+            sum += h_csr_val[j] * h_x[h_csr_col_ind[j]];
+        }
+        expected_y[i] = alpha * sum + beta * h_y[i];
+    }
 
     // 2. Prepare device for calculation
 
@@ -92,11 +155,11 @@ int main()
     double*        d_x;
     double*        d_y;
 
-    constexpr size_t x_size       = sizeof(*d_x) * n;
-    constexpr size_t y_size       = sizeof(*d_y) * m;
-    constexpr size_t val_size     = sizeof(*d_csr_val) * nnz;
-    constexpr size_t row_ptr_size = sizeof(*d_csr_row_ptr) * (m + 1);
-    constexpr size_t col_ind_size = sizeof(*d_csr_col_ind) * nnz;
+    const size_t x_size       = sizeof(*d_x) * n;
+    const size_t y_size       = sizeof(*d_y) * m;
+    const size_t val_size     = sizeof(*d_csr_val) * nnz;
+    const size_t row_ptr_size = sizeof(*d_csr_row_ptr) * (m + 1);
+    const size_t col_ind_size = sizeof(*d_csr_col_ind) * nnz;
 
     HIP_CHECK(hipMalloc(&d_csr_row_ptr, row_ptr_size));
     HIP_CHECK(hipMalloc(&d_csr_col_ind, col_ind_size));
@@ -142,6 +205,24 @@ int main()
     HIP_CHECK(hipFree(d_y));
 
     // 8. Print result
-    std::cout << "y = " << format_range(std::begin(h_y), std::end(h_y)) << std::endl;
-    return 0;
+    if(file.empty())
+    {
+        std::cout << "y = " << format_range(std::begin(h_y), std::end(h_y)) << std::endl;
+    }
+    else
+    {
+        std::cout << "Computed y = alpha * A * x + beta * y for a " << m << "x" << n
+                  << " matrix with " << nnz << " non-zero elements." << std::endl;
+    }
+
+    // 9. Compare the result with the host reference. The tolerance is relative to the magnitude
+    // of the result, as the order of the additions of each row may differ.
+    int          errors = 0;
+    const double eps    = 1.0e5 * std::numeric_limits<double>::epsilon();
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        errors += std::fabs(h_y[i] - expected_y[i])
+                  > eps * std::max(1.0, std::fabs(expected_y[i]));
+    }
+    return report_validation_result(errors);
 }